@@ -29,7 +29,8 @@ public class ObjectProfilerEditor : ModuleRules
 			"Json",
 			"JsonUtilities",
 			"ContentBrowser",
-			"UMG"
+			"UMG",
+			"ObjectProfilerStartup"
 		});
 	}
 }
\ No newline at end of file
@@ -0,0 +1,129 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerArchiveSizer.h"
+#include "ObjectProfilerCore.h"
+#include "ObjectProfilerGovernor.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectHash.h"
+
+TArray<FObjectProfilerArchiveSizer::FPendingMeasure> FObjectProfilerArchiveSizer::PendingObjects;
+int32 FObjectProfilerArchiveSizer::NextObjectIndex = 0;
+TArray<FArchiveSizeEntry> FObjectProfilerArchiveSizer::Entries;
+FOnArchiveSizeComplete FObjectProfilerArchiveSizer::CompletionDelegate;
+FTSTicker::FDelegateHandle FObjectProfilerArchiveSizer::TickerHandle;
+
+bool FObjectProfilerArchiveSizer::Start(const TArray<TSharedPtr<FObjectClassStats>>& Stats, int32 MaxSamplesPerClass, FOnArchiveSizeComplete OnComplete)
+{
+	if (IsRunning())
+	{
+		return false;
+	}
+
+	PendingObjects.Reset();
+	NextObjectIndex = 0;
+	Entries.Reset();
+	CompletionDelegate = OnComplete;
+
+	TArray<UObject*> ClassObjects;
+	for (const TSharedPtr<FObjectClassStats>& ClassStats : Stats)
+	{
+		UClass* Class = ClassStats.IsValid() ? ClassStats->GetClass() : nullptr;
+		if (!Class)
+		{
+			continue;
+		}
+
+		ClassObjects.Reset();
+		GetObjectsOfClass(Class, ClassObjects, false, RF_ClassDefaultObject | RF_ArchetypeObject);
+		if (ClassObjects.Num() == 0)
+		{
+			continue;
+		}
+
+		const int32 EntryIndex = Entries.Num();
+		FArchiveSizeEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.ClassName = ClassStats->ClassName;
+		Entry.InstanceCount = ClassObjects.Num();
+
+		const int32 SampleCount = MaxSamplesPerClass > 0 ? FMath::Min(MaxSamplesPerClass, ClassObjects.Num()) : ClassObjects.Num();
+		for (int32 SampleIndex = 0; SampleIndex < SampleCount; ++SampleIndex)
+		{
+			const int32 ObjectIndex = static_cast<int32>(static_cast<int64>(SampleIndex) * ClassObjects.Num() / SampleCount);
+			PendingObjects.Add({ ClassObjects[ObjectIndex], EntryIndex });
+		}
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FObjectProfilerArchiveSizer::OnTick), 0.0f);
+	return true;
+}
+
+void FObjectProfilerArchiveSizer::Cancel()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	PendingObjects.Empty();
+	Entries.Empty();
+	CompletionDelegate.Unbind();
+}
+
+bool FObjectProfilerArchiveSizer::IsRunning()
+{
+	return TickerHandle.IsValid();
+}
+
+float FObjectProfilerArchiveSizer::GetProgress()
+{
+	return PendingObjects.Num() > 0 ? static_cast<float>(NextObjectIndex) / PendingObjects.Num() : 1.0f;
+}
+
+bool FObjectProfilerArchiveSizer::OnTick(float DeltaTime)
+{
+	FScopedProfilerCost Cost(EProfilerCostBucket::AsyncCollection);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Budget = FObjectProfilerGovernor::ScaleWorkBudget(TickBudgetSeconds);
+
+	while (NextObjectIndex < PendingObjects.Num())
+	{
+		const FPendingMeasure& Pending = PendingObjects[NextObjectIndex++];
+		if (UObject* Object = Pending.Object.Get())
+		{
+			FArchiveCountMem Counter(Object);
+			FArchiveSizeEntry& Entry = Entries[Pending.EntryIndex];
+			Entry.MeasuredBytes += static_cast<int64>(Counter.GetMax());
+			Entry.MeasuredResourceBytes += FObjectProfilerCore::GetObjectSize(Object);
+			Entry.MeasuredCount++;
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= Budget)
+		{
+			return true;
+		}
+	}
+
+	Finish();
+	return false;
+}
+
+void FObjectProfilerArchiveSizer::Finish()
+{
+	TickerHandle.Reset();
+
+	TArray<FArchiveSizeEntry> Results = MoveTemp(Entries);
+	Results.RemoveAll([](const FArchiveSizeEntry& Entry) { return Entry.MeasuredCount == 0; });
+	Results.Sort([](const FArchiveSizeEntry& A, const FArchiveSizeEntry& B)
+	{
+		return A.GetUnderReportedBytes() > B.GetUnderReportedBytes();
+	});
+
+	PendingObjects.Empty();
+	Entries.Empty();
+
+	FOnArchiveSizeComplete Delegate = CompletionDelegate;
+	CompletionDelegate.Unbind();
+	Delegate.ExecuteIfBound(Results);
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerContainerSlack.h"
+#include "ObjectProfilerCore.h"
+#include "ObjectProfilerGovernor.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectHash.h"
+
+TArray<TWeakObjectPtr<UObject>> FObjectProfilerContainerSlack::PendingObjects;
+int32 FObjectProfilerContainerSlack::NextObjectIndex = 0;
+TMap<const UClass*, FObjectProfilerContainerSlack::FClassScan> FObjectProfilerContainerSlack::ClassScans;
+FOnContainerSlackComplete FObjectProfilerContainerSlack::CompletionDelegate;
+FTSTicker::FDelegateHandle FObjectProfilerContainerSlack::TickerHandle;
+
+void FContainerSlackEntry::OfferExample(const UObject* Object, int64 WastedBytes)
+{
+	if (Examples.Num() >= MaxExamples && WastedBytes <= Examples.Last().Value)
+	{
+		return;
+	}
+
+	const int32 InsertIndex = Examples.IndexOfByPredicate([WastedBytes](const TPair<FString, int64>& Example) { return WastedBytes > Example.Value; });
+	Examples.Insert(TPair<FString, int64>(Object->GetPathName(), WastedBytes), InsertIndex == INDEX_NONE ? Examples.Num() : InsertIndex);
+
+	if (Examples.Num() > MaxExamples)
+	{
+		Examples.Pop();
+	}
+}
+
+bool FObjectProfilerContainerSlack::Start(const TArray<UClass*>& Classes, FOnContainerSlackComplete OnComplete)
+{
+	if (IsRunning())
+	{
+		return false;
+	}
+
+	PendingObjects.Reset();
+	NextObjectIndex = 0;
+	ClassScans.Reset();
+	CompletionDelegate = OnComplete;
+
+	TArray<UObject*> ClassObjects;
+	for (UClass* Class : Classes)
+	{
+		if (!Class || FindOrAddClassScan(Class).Slots.Num() == 0)
+		{
+			continue;
+		}
+
+		ClassObjects.Reset();
+		GetObjectsOfClass(Class, ClassObjects, false, RF_ClassDefaultObject | RF_ArchetypeObject);
+		for (UObject* Object : ClassObjects)
+		{
+			PendingObjects.Add(Object);
+		}
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FObjectProfilerContainerSlack::OnTick), 0.0f);
+	return true;
+}
+
+void FObjectProfilerContainerSlack::Cancel()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	PendingObjects.Empty();
+	ClassScans.Empty();
+	CompletionDelegate.Unbind();
+}
+
+bool FObjectProfilerContainerSlack::IsRunning()
+{
+	return TickerHandle.IsValid();
+}
+
+float FObjectProfilerContainerSlack::GetProgress()
+{
+	return PendingObjects.Num() > 0 ? static_cast<float>(NextObjectIndex) / PendingObjects.Num() : 1.0f;
+}
+
+bool FObjectProfilerContainerSlack::OnTick(float DeltaTime)
+{
+	FScopedProfilerCost Cost(EProfilerCostBucket::AsyncCollection);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Budget = FObjectProfilerGovernor::ScaleWorkBudget(TickBudgetSeconds);
+
+	while (NextObjectIndex < PendingObjects.Num())
+	{
+		if (UObject* Object = PendingObjects[NextObjectIndex].Get())
+		{
+			ScanObject(Object);
+		}
+		NextObjectIndex++;
+
+		if ((NextObjectIndex & 63) == 0 && FPlatformTime::Seconds() - StartTime >= Budget)
+		{
+			return true;
+		}
+	}
+
+	Finish();
+	return false;
+}
+
+void FObjectProfilerContainerSlack::ScanObject(UObject* Object)
+{
+	FClassScan& Scan = FindOrAddClassScan(Object->GetClass());
+
+	for (int32 SlotIndex = 0; SlotIndex < Scan.Slots.Num(); ++SlotIndex)
+	{
+		const FContainerSlot& Slot = Scan.Slots[SlotIndex];
+
+		int64 UsedBytes = 0;
+		int64 AllocatedBytes = 0;
+		MeasureContainer(Slot.Property, reinterpret_cast<const uint8*>(Object) + Slot.Offset, UsedBytes, AllocatedBytes);
+
+		if (AllocatedBytes == 0)
+		{
+			continue;
+		}
+
+		FContainerSlackEntry& Entry = Scan.Entries[SlotIndex];
+		Entry.InstanceCount++;
+		Entry.UsedBytes += UsedBytes;
+		Entry.AllocatedBytes += AllocatedBytes;
+
+		if (AllocatedBytes > UsedBytes)
+		{
+			Entry.OfferExample(Object, AllocatedBytes - UsedBytes);
+		}
+	}
+}
+
+FObjectProfilerContainerSlack::FClassScan& FObjectProfilerContainerSlack::FindOrAddClassScan(const UClass* Class)
+{
+	if (FClassScan* Existing = ClassScans.Find(Class))
+	{
+		return *Existing;
+	}
+
+	FClassScan& Scan = ClassScans.Add(Class);
+	GatherContainerSlots(Class, 0, FString(), 0, Scan.Slots);
+
+	for (const FContainerSlot& Slot : Scan.Slots)
+	{
+		FContainerSlackEntry& Entry = Scan.Entries.AddDefaulted_GetRef();
+		Entry.ClassName = Class->GetName();
+		Entry.PropertyName = Slot.Name;
+		Entry.ContainerType = Slot.Property->IsA<FArrayProperty>() ? TEXT("Array") : Slot.Property->IsA<FMapProperty>() ? TEXT("Map") : TEXT("Set");
+	}
+
+	return Scan;
+}
+
+void FObjectProfilerContainerSlack::GatherContainerSlots(const UStruct* Struct, int32 BaseOffset, const FString& Prefix, int32 Depth, TArray<FContainerSlot>& OutSlots)
+{
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		const FProperty* Property = *It;
+		const int32 Offset = BaseOffset + Property->GetOffset_ForInternal();
+		const FString Name = Prefix + Property->GetName();
+
+		if (Property->IsA<FArrayProperty>() || Property->IsA<FMapProperty>() || Property->IsA<FSetProperty>())
+		{
+			FContainerSlot& Slot = OutSlots.AddDefaulted_GetRef();
+			Slot.Property = Property;
+			Slot.Offset = Offset;
+			Slot.Name = Name;
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			const int32 StructSize = StructProperty->Struct->GetStructureSize();
+			const int32 ElementCount = StructSize > 0 ? Property->GetSize() / StructSize : 0;
+
+			for (int32 ElementIndex = 0; ElementIndex < ElementCount && Depth < MaxStructDepth; ++ElementIndex)
+			{
+				const FString ElementName = ElementCount > 1 ? FString::Printf(TEXT("%s[%d]"), *Name, ElementIndex) : Name;
+				GatherContainerSlots(StructProperty->Struct, Offset + ElementIndex * StructSize, ElementName + TEXT("."), Depth + 1, OutSlots);
+			}
+		}
+	}
+}
+
+void FObjectProfilerContainerSlack::MeasureContainer(const FProperty* Property, const void* ValuePtr, int64& OutUsedBytes, int64& OutAllocatedBytes)
+{
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		const FScriptArray* Array = static_cast<const FScriptArray*>(ValuePtr);
+		const int64 ElementSize = ArrayProperty->Inner->GetSize();
+		OutUsedBytes = Array->Num() * ElementSize;
+		OutAllocatedBytes = (Array->Num() + Array->GetSlack()) * ElementSize;
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Helper(SetProperty, ValuePtr);
+		const int64 SlotSize = SetProperty->SetLayout.Size;
+		OutUsedBytes = Helper.Num() * SlotSize + FObjectProfilerCore::GetHashBytes(Helper.Num());
+		OutAllocatedBytes = FObjectProfilerCore::GetSparseCapacity(ValuePtr) * SlotSize + FObjectProfilerCore::GetHashBytes(Helper.GetMaxIndex());
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper Helper(MapProperty, ValuePtr);
+		const int64 SlotSize = MapProperty->MapLayout.SetLayout.Size;
+		OutUsedBytes = Helper.Num() * SlotSize + FObjectProfilerCore::GetHashBytes(Helper.Num());
+		OutAllocatedBytes = FObjectProfilerCore::GetSparseCapacity(ValuePtr) * SlotSize + FObjectProfilerCore::GetHashBytes(Helper.GetMaxIndex());
+	}
+}
+
+void FObjectProfilerContainerSlack::Finish()
+{
+	TickerHandle.Reset();
+
+	TArray<FContainerSlackEntry> Results;
+	for (TPair<const UClass*, FClassScan>& Pair : ClassScans)
+	{
+		for (FContainerSlackEntry& Entry : Pair.Value.Entries)
+		{
+			if (Entry.GetWastedBytes() > 0)
+			{
+				Results.Add(MoveTemp(Entry));
+			}
+		}
+	}
+
+	Results.Sort([](const FContainerSlackEntry& A, const FContainerSlackEntry& B)
+	{
+		return A.GetWastedBytes() > B.GetWastedBytes();
+	});
+
+	PendingObjects.Empty();
+	ClassScans.Empty();
+
+	FOnContainerSlackComplete Delegate = CompletionDelegate;
+	CompletionDelegate.Unbind();
+	Delegate.ExecuteIfBound(Results);
+}
\ No newline at end of file
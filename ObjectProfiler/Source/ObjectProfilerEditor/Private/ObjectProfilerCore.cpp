@@ -1,9 +1,15 @@
 ﻿//Copyright PsinaDev 2025.
 
 #include "ObjectProfilerCore.h"
+#include "ObjectProfilerSession.h"
+#include "ObjectProfilerGovernor.h"
+#include "ObjectProfilerMemoryReconciliation.h"
 #include "UObject/UObjectIterator.h"
 #include "UObject/UObjectArray.h"
+#include "UObject/UObjectHash.h"
 #include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
 #include "Engine/Texture.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/SkeletalMesh.h"
@@ -19,32 +25,50 @@
 #include "Engine/GameInstance.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Misc/FileHelper.h"
+#include "Editor.h"
+#include "ContentBrowserModule.h"
+#include "IContentBrowserSingleton.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Dom/JsonObject.h"
 
-TArray<FObjectSnapshot> FObjectProfilerCore::SnapshotHistory;
-TMap<FString, TSharedPtr<FObjectClassStats>> FObjectProfilerCore::PreviousStats;
+TSharedPtr<FObjectProfilerSession> FObjectProfilerCore::DefaultSession;
 FObjectProfilerCore::FAsyncCollectionState FObjectProfilerCore::AsyncState;
+TArray<FObjectProfilerCore::FQueuedCollection> FObjectProfilerCore::QueuedCollections;
 bool FObjectProfilerCore::bCancellationRequested = false;
+ECollectionConsistency FObjectProfilerCore::CollectionConsistency = ECollectionConsistency::CollectionEnd;
+ECollectionSizing FObjectProfilerCore::CollectionSizing = ECollectionSizing::Inline;
+EResourceSizeMode::Type FObjectProfilerCore::ResourceSizeMode = EResourceSizeMode::EstimatedTotal;
 
-FTSTicker::FDelegateHandle FObjectProfilerCore::RealTimeTickerHandle;
-float FObjectProfilerCore::RealTimeIntervalSeconds = 1.0f;
-bool FObjectProfilerCore::bRealTimeMonitoringActive = false;
-double FObjectProfilerCore::LastRealTimeUpdateTime = 0.0;
-int32 FObjectProfilerCore::LeakDetectionThreshold = 5;
+FCriticalSection FObjectProfilerCore::JournalLock;
+TArray<FObjectProfilerCore::FJournalEntry> FObjectProfilerCore::JournalEntries;
+TMap<int32, int32> FObjectProfilerCore::JournalOpenEntries;
+TBitArray<> FObjectProfilerCore::JournalCountedIndices;
+FObjectProfilerCore::FJournalCreateListener* FObjectProfilerCore::JournalCreateListener = nullptr;
+FObjectProfilerCore::FJournalDeleteListener* FObjectProfilerCore::JournalDeleteListener = nullptr;
 
-FOnRealTimeUpdate FObjectProfilerCore::RealTimeUpdateDelegate;
-FOnSnapshotTaken FObjectProfilerCore::SnapshotTakenDelegate;
+TArray<FObjectProfilerCore::FPendingHeapWalk> FObjectProfilerCore::PendingHeapWalks;
+FTSTicker::FDelegateHandle FObjectProfilerCore::HeapWalkTickerHandle;
+TArray<FLargestObjectEntry> FObjectProfilerCore::LatestLargestObjects;
 
 FCriticalSection FObjectProfilerCore::IncrementalDataLock;
 TMap<UClass*, FObjectProfilerCore::FIncrementalClassData> FObjectProfilerCore::IncrementalClassCounts;
+TMap<TObjectKey<UClass>, TSharedPtr<const FObjectProfilerCore::FIncrementalClassInfo, ESPMode::ThreadSafe>> FObjectProfilerCore::IncrementalClassInfos;
 bool FObjectProfilerCore::bIncrementalTrackingActive = false;
+int32 FObjectProfilerCore::IncrementalTrackingUsers = 0;
 FObjectProfilerCore::FProfilerCreateListener* FObjectProfilerCore::CreateListener = nullptr;
 FObjectProfilerCore::FProfilerDeleteListener* FObjectProfilerCore::DeleteListener = nullptr;
+TArray<uint16> FObjectProfilerCore::ObjectWorldSlots;
+TArray<TWeakObjectPtr<UWorld>> FObjectProfilerCore::WorldSlots;
+TMap<FObjectKey, uint16> FObjectProfilerCore::WorldSlotLookup;
+TMap<FObjectKey, UWorld*> FObjectProfilerCore::IncrementalOuterToWorld;
+
+FDelegateHandle FObjectProfilerCore::PostGarbageCollectHandle;
 
 void FObjectProfilerCore::FProfilerCreateListener::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
 {
+	FScopedProfilerCost Cost(EProfilerCostBucket::Listeners);
+	
 	if (!Object)
 	{
 		return;
@@ -65,7 +89,15 @@ void FObjectProfilerCore::FProfilerCreateListener::NotifyUObjectCreated(const UO
 	FScopeLock Lock(&IncrementalDataLock);
 	FIncrementalClassData& Data = IncrementalClassCounts.FindOrAdd(ObjClass);
 	Data.Count++;
-	Data.bDirty = true;
+	
+	const uint16 WorldSlot = GetIncrementalWorldSlot(static_cast<const UObject*>(Object));
+	Data.WorldCounts.FindOrAdd(WorldSlot)++;
+	
+	if (Index >= ObjectWorldSlots.Num())
+	{
+		ObjectWorldSlots.SetNumZeroed(FMath::Max(Index + 1, ObjectWorldSlots.Num() * 2));
+	}
+	ObjectWorldSlots[Index] = WorldSlot;
 }
 
 void FObjectProfilerCore::FProfilerCreateListener::OnUObjectArrayShutdown()
@@ -75,6 +107,8 @@ void FObjectProfilerCore::FProfilerCreateListener::OnUObjectArrayShutdown()
 
 void FObjectProfilerCore::FProfilerDeleteListener::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
 {
+	FScopedProfilerCost Cost(EProfilerCostBucket::Listeners);
+	
 	if (!Object)
 	{
 		return;
@@ -87,10 +121,25 @@ void FObjectProfilerCore::FProfilerDeleteListener::NotifyUObjectDeleted(const UO
 	}
 	
 	FScopeLock Lock(&IncrementalDataLock);
+	
+	uint16 WorldSlot = 0;
+	if (ObjectWorldSlots.IsValidIndex(Index))
+	{
+		WorldSlot = ObjectWorldSlots[Index];
+		ObjectWorldSlots[Index] = 0;
+	}
+	
 	if (FIncrementalClassData* Data = IncrementalClassCounts.Find(ObjClass))
 	{
 		Data->Count--;
-		Data->bDirty = true;
+		
+		if (int32* WorldCount = Data->WorldCounts.Find(WorldSlot))
+		{
+			if (--(*WorldCount) <= 0)
+			{
+				Data->WorldCounts.Remove(WorldSlot);
+			}
+		}
 		
 		if (Data->Count <= 0)
 		{
@@ -104,6 +153,64 @@ void FObjectProfilerCore::FProfilerDeleteListener::OnUObjectArrayShutdown()
 	GUObjectArray.RemoveUObjectDeleteListener(this);
 }
 
+void FObjectProfilerCore::FJournalCreateListener::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
+{
+	FScopedProfilerCost Cost(EProfilerCostBucket::Listeners);
+	
+	if (!Object || (Object->GetFlags() & (RF_ClassDefaultObject | RF_ArchetypeObject)))
+	{
+		return;
+	}
+	
+	FJournalEntry Entry;
+	Entry.Class = Object->GetClass();
+	Entry.ObjectIndex = Index;
+	
+	FScopeLock Lock(&JournalLock);
+	JournalOpenEntries.Add(Index, JournalEntries.Add(Entry));
+}
+
+void FObjectProfilerCore::FJournalCreateListener::OnUObjectArrayShutdown()
+{
+	GUObjectArray.RemoveUObjectCreateListener(this);
+}
+
+void FObjectProfilerCore::FJournalDeleteListener::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
+{
+	FScopedProfilerCost Cost(EProfilerCostBucket::Listeners);
+	
+	if (!Object || (Object->GetFlags() & (RF_ClassDefaultObject | RF_ArchetypeObject)))
+	{
+		return;
+	}
+	
+	FScopeLock Lock(&JournalLock);
+	
+	const bool bCounted = JournalCountedIndices.IsValidIndex(Index) && JournalCountedIndices[Index];
+	if (bCounted)
+	{
+		JournalCountedIndices[Index] = false;
+	}
+	
+	int32 EntryIndex = INDEX_NONE;
+	if (!JournalOpenEntries.RemoveAndCopyValue(Index, EntryIndex))
+	{
+		FJournalEntry Entry;
+		Entry.Class = Object->GetClass();
+		Entry.ObjectIndex = Index;
+		Entry.bExistedAtStart = true;
+		EntryIndex = JournalEntries.Add(Entry);
+	}
+	
+	JournalEntries[EntryIndex].bDeleted = true;
+	JournalEntries[EntryIndex].bCounted = bCounted;
+}
+
+void FObjectProfilerCore::FJournalDeleteListener::OnUObjectArrayShutdown()
+{
+	GUObjectArray.RemoveUObjectDeleteListener(this);
+}
+
 void FObjectProfilerCore::StartIncrementalTracking()
 {
 	if (bIncrementalTrackingActive)
@@ -116,6 +223,13 @@ void FObjectProfilerCore::StartIncrementalTracking()
 		IncrementalClassCounts.Empty();
 		IncrementalClassCounts.Reserve(2000);
 		
+		ObjectWorldSlots.Reset();
+		ObjectWorldSlots.SetNumZeroed(GUObjectArray.GetObjectArrayNum());
+		WorldSlots.Reset();
+		WorldSlots.Add(nullptr);
+		WorldSlotLookup.Reset();
+		IncrementalOuterToWorld.Reset();
+		
 		for (TObjectIterator<UObject> It; It; ++It)
 		{
 			UObject* Obj = *It;
@@ -127,7 +241,17 @@ void FObjectProfilerCore::StartIncrementalTracking()
 			UClass* ObjClass = Obj->GetClass();
 			if (ObjClass)
 			{
-				IncrementalClassCounts.FindOrAdd(ObjClass).Count++;
+				FIncrementalClassData& Data = IncrementalClassCounts.FindOrAdd(ObjClass);
+				Data.Count++;
+				
+				const uint16 WorldSlot = GetIncrementalWorldSlot(Obj);
+				Data.WorldCounts.FindOrAdd(WorldSlot)++;
+				
+				const int32 Index = GUObjectArray.ObjectToIndex(Obj);
+				if (ObjectWorldSlots.IsValidIndex(Index))
+				{
+					ObjectWorldSlots[Index] = WorldSlot;
+				}
 			}
 		}
 	}
@@ -139,6 +263,7 @@ void FObjectProfilerCore::StartIncrementalTracking()
 	GUObjectArray.AddUObjectDeleteListener(DeleteListener);
 	
 	bIncrementalTrackingActive = true;
+	RefreshGarbageCollectBinding();
 	
 	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Incremental tracking started with %d classes"), IncrementalClassCounts.Num());
 }
@@ -167,9 +292,15 @@ void FObjectProfilerCore::StopIncrementalTracking()
 	{
 		FScopeLock Lock(&IncrementalDataLock);
 		IncrementalClassCounts.Empty();
+		IncrementalClassInfos.Empty();
+		ObjectWorldSlots.Empty();
+		WorldSlots.Empty();
+		WorldSlotLookup.Empty();
+		IncrementalOuterToWorld.Empty();
 	}
 	
 	bIncrementalTrackingActive = false;
+	RefreshGarbageCollectBinding();
 	
 	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Incremental tracking stopped"));
 }
@@ -179,14 +310,49 @@ bool FObjectProfilerCore::IsIncrementalTrackingActive()
 	return bIncrementalTrackingActive;
 }
 
+void FObjectProfilerCore::AcquireIncrementalTracking()
+{
+	if (IncrementalTrackingUsers++ == 0)
+	{
+		StartIncrementalTracking();
+	}
+}
+
+void FObjectProfilerCore::ReleaseIncrementalTracking()
+{
+	if (IncrementalTrackingUsers > 0 && --IncrementalTrackingUsers == 0)
+	{
+		StopIncrementalTracking();
+	}
+}
+
 TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::GetIncrementalStats()
 {
-	TArray<TSharedPtr<FObjectClassStats>> Result;
-	const double CurrentTime = FPlatformTime::Seconds();
+	return GetDefaultSession()->UpdateFromIncrementalCounts();
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::BuildIncrementalStats()
+{
+	FIncrementalCountsSnapshot Counts;
+	SnapshotIncrementalCounts(Counts);
+	return BuildStatsFromCounts(Counts);
+}
+
+void FObjectProfilerCore::SnapshotIncrementalCounts(FIncrementalCountsSnapshot& OutCounts)
+{
+	check(IsInGameThread());
 	
 	FScopeLock Lock(&IncrementalDataLock);
 	
-	Result.Reserve(IncrementalClassCounts.Num());
+	OutCounts.WorldSlotLabels.Reset(WorldSlots.Num());
+	for (int32 SlotIndex = 0; SlotIndex < WorldSlots.Num(); ++SlotIndex)
+	{
+		const UWorld* World = WorldSlots[SlotIndex].Get();
+		OutCounts.WorldSlotLabels.Add(SlotIndex == 0 || World ? GetWorldLabel(World) : FName(TEXT("Destroyed World")));
+	}
+	
+	OutCounts.Entries.Reset(IncrementalClassCounts.Num());
+	OutCounts.WorldCounts.Reset(IncrementalClassCounts.Num() * 2);
 	
 	for (auto& Pair : IncrementalClassCounts)
 	{
@@ -198,39 +364,77 @@ TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::GetIncrementalStats()
 			continue;
 		}
 		
-		TSharedPtr<FObjectClassStats> Stats = MakeShared<FObjectClassStats>();
-		Stats->ClassName = ObjClass->GetName();
-		Stats->ClassFName = ObjClass->GetFName();
-		Stats->ClassPtr = ObjClass;
-		Stats->InstanceCount = Data.Count;
-		Stats->bSizeAvailable = false;
-		
-		if (Data.CachedCategory == EObjectCategory::Unknown && Data.bDirty)
+		if (!Data.Info.IsValid())
 		{
-			Data.CachedCategory = CategorizeClass(ObjClass);
-			Data.CachedSource = GetObjectSource(ObjClass);
-			Data.CachedModuleName = GetModuleName(ObjClass);
-			Data.bDirty = false;
+			Data.Info = GetIncrementalClassInfo(ObjClass);
 		}
 		
-		Stats->Category = Data.CachedCategory;
-		Stats->Source = Data.CachedSource;
-		Stats->ModuleName = Data.CachedModuleName;
+		FIncrementalCountsSnapshot::FEntry& Entry = OutCounts.Entries.AddDefaulted_GetRef();
+		Entry.Info = Data.Info;
+		Entry.Count = Data.Count;
+		Entry.FirstWorldCount = OutCounts.WorldCounts.Num();
+		Entry.NumWorldCounts = Data.WorldCounts.Num();
 		
-		if (const TSharedPtr<FObjectClassStats>* PrevStats = PreviousStats.Find(Stats->ClassName))
+		for (const TPair<uint16, int32>& WorldPair : Data.WorldCounts)
 		{
-			Stats->DeltaCount = Stats->InstanceCount - (*PrevStats)->InstanceCount;
-			Stats->History = (*PrevStats)->History;
-			Stats->TotalSizeBytes = (*PrevStats)->TotalSizeBytes;
-			Stats->AverageSizeBytes = (*PrevStats)->AverageSizeBytes;
-			Stats->bSizeAvailable = (*PrevStats)->bSizeAvailable;
+			OutCounts.WorldCounts.Add(WorldPair);
 		}
+	}
+}
+
+TSharedPtr<const FObjectProfilerCore::FIncrementalClassInfo, ESPMode::ThreadSafe> FObjectProfilerCore::GetIncrementalClassInfo(UClass* InClass)
+{
+	if (!InClass)
+	{
+		return nullptr;
+	}
+	
+	if (const TSharedPtr<const FIncrementalClassInfo, ESPMode::ThreadSafe>* Existing = IncrementalClassInfos.Find(InClass))
+	{
+		return *Existing;
+	}
+	
+	TSharedPtr<FIncrementalClassInfo, ESPMode::ThreadSafe> Info = MakeShared<FIncrementalClassInfo, ESPMode::ThreadSafe>();
+	Info->ClassPtr = InClass;
+	Info->ClassName = InClass->GetName();
+	Info->ClassFName = InClass->GetFName();
+	Info->Category = CategorizeClass(InClass);
+	Info->Source = GetObjectSource(InClass);
+	Info->ModuleName = GetModuleName(InClass);
+	Info->SuperInfo = GetIncrementalClassInfo(InClass->GetSuperClass());
+	
+	IncrementalClassInfos.Add(InClass, Info);
+	return Info;
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::BuildStatsFromCounts(const FIncrementalCountsSnapshot& Counts)
+{
+	TArray<TSharedPtr<FObjectClassStats>> Result;
+	Result.Reserve(Counts.Entries.Num());
+	
+	for (const FIncrementalCountsSnapshot::FEntry& Entry : Counts.Entries)
+	{
+		const FIncrementalClassInfo& Info = *Entry.Info;
+		
+		TSharedPtr<FObjectClassStats> Stats = MakeShared<FObjectClassStats>();
+		Stats->ClassName = Info.ClassName;
+		Stats->ClassFName = Info.ClassFName;
+		Stats->ClassPtr = Info.ClassPtr;
+		Stats->InstanceCount = Entry.Count;
+		Stats->bSizeAvailable = false;
+		Stats->Category = Info.Category;
+		Stats->Source = Info.Source;
+		Stats->ModuleName = Info.ModuleName;
 		
-		Stats->AddHistoryPoint(Stats->InstanceCount, Stats->TotalSizeBytes, CurrentTime);
-		Stats->UpdateLeakDetection(LeakDetectionThreshold);
-		Stats->CalculateRateOfChange();
+		for (int32 WorldIndex = Entry.FirstWorldCount; WorldIndex < Entry.FirstWorldCount + Entry.NumWorldCounts; ++WorldIndex)
+		{
+			const TPair<uint16, int32>& WorldPair = Counts.WorldCounts[WorldIndex];
+			if (Counts.WorldSlotLabels.IsValidIndex(WorldPair.Key))
+			{
+				Stats->WorldStats.FindOrAdd(Counts.WorldSlotLabels[WorldPair.Key]).InstanceCount += WorldPair.Value;
+			}
+		}
 		
-		PreviousStats.Add(Stats->ClassName, Stats);
 		Result.Add(Stats);
 	}
 	
@@ -270,121 +474,511 @@ bool FObjectProfilerCore::IsSafeForResourceSizeQuery(const UObject* Obj)
 	return true;
 }
 
-EObjectCategory FObjectProfilerCore::CategorizeClass(const UClass* InClass)
+UWorld* FObjectProfilerCore::ResolveOwningWorld(const UObject* Object, TMap<FObjectKey, UWorld*>& OuterToWorld)
 {
-	if (!InClass)
+	if (!Object)
 	{
-		return EObjectCategory::Unknown;
+		return nullptr;
 	}
-
-	if (InClass->IsChildOf(AActor::StaticClass()))
+	
+	if (const UWorld* ObjectAsWorld = Cast<UWorld>(Object))
 	{
-		return EObjectCategory::Actor;
+		return const_cast<UWorld*>(ObjectAsWorld);
 	}
-	if (InClass->IsChildOf(UActorComponent::StaticClass()))
+	
+	TArray<FObjectKey, TInlineAllocator<16>> VisitedOuters;
+	UWorld* FoundWorld = nullptr;
+	bool bCacheable = true;
+	
+	for (const UObject* Outer = Object->GetOuter(); Outer; Outer = Outer->GetOuter())
 	{
-		return EObjectCategory::Component;
+		const FObjectKey OuterKey(Outer);
+		if (UWorld** CachedWorld = OuterToWorld.Find(OuterKey))
+		{
+			FoundWorld = *CachedWorld;
+			break;
+		}
+		
+		VisitedOuters.Add(OuterKey);
+		
+		if (const ULevel* OuterLevel = Cast<ULevel>(Outer))
+		{
+			if (OuterLevel->OwningWorld)
+			{
+				FoundWorld = OuterLevel->OwningWorld;
+				break;
+			}
+			
+			// Streaming levels get their owning world only once added to it.
+			bCacheable = false;
+		}
+		
+		if (const UWorld* OuterWorld = Cast<UWorld>(Outer))
+		{
+			FoundWorld = const_cast<UWorld*>(OuterWorld);
+			break;
+		}
 	}
-	if (InClass->IsChildOf(UUserWidget::StaticClass()))
+	
+	if (bCacheable)
 	{
-		return EObjectCategory::Widget;
+		for (const FObjectKey& Visited : VisitedOuters)
+		{
+			OuterToWorld.Add(Visited, FoundWorld);
+		}
 	}
-	if (InClass->IsChildOf(UTexture::StaticClass()))
+	
+	return FoundWorld;
+}
+
+FName FObjectProfilerCore::ResolveWorldLabel(const UObject* Object, FWorldResolveCache& Cache)
+{
+	const UWorld* World = ResolveOwningWorld(Object, Cache.OuterToWorld);
+	
+	if (const FName* CachedLabel = Cache.WorldLabels.Find(World))
 	{
-		return EObjectCategory::Texture;
+		return *CachedLabel;
 	}
-	if (InClass->IsChildOf(UStaticMesh::StaticClass()) || InClass->IsChildOf(USkeletalMesh::StaticClass()))
+	
+	return Cache.WorldLabels.Add(World, GetWorldLabel(World));
+}
+
+FName FObjectProfilerCore::ResolvePackageLabel(const UObject* Object)
+{
+	const UPackage* Package = Object->GetPackage();
+	return Package ? Package->GetFName() : FName(TEXT("No Package"));
+}
+
+FString FObjectProfilerCore::GetOwnerLabel(FName OwnerLabel)
+{
+	return OwnerLabel.ToString();
+}
+
+FString FObjectProfilerCore::GetOwnerLabel(const FObjectKey& OuterKey)
+{
+	if (OuterKey == FObjectKey())
 	{
-		return EObjectCategory::Mesh;
+		return TEXT("No Outer");
 	}
-	if (InClass->IsChildOf(UMaterialInterface::StaticClass()))
+	
+	const UObject* Outer = OuterKey.ResolveObjectPtr();
+	return Outer ? Outer->GetPathName() : FString(TEXT("Destroyed Outer"));
+}
+
+uint16 FObjectProfilerCore::GetIncrementalWorldSlot(const UObject* Object)
+{
+	const UWorld* World = ResolveOwningWorld(Object, IncrementalOuterToWorld);
+	if (!World)
 	{
-		return EObjectCategory::Material;
+		return 0;
 	}
-	if (InClass->IsChildOf(USoundBase::StaticClass()))
+	
+	const FObjectKey WorldKey(World);
+	if (const uint16* ExistingSlot = WorldSlotLookup.Find(WorldKey))
 	{
-		return EObjectCategory::Audio;
+		return *ExistingSlot;
 	}
-	if (InClass->IsChildOf(UAnimationAsset::StaticClass()))
+	
+	if (WorldSlots.Num() >= MAX_uint16)
 	{
-		return EObjectCategory::Animation;
+		return 0;
 	}
-	if (InClass->IsChildOf(UBlueprint::StaticClass()))
+	
+	const uint16 NewSlot = static_cast<uint16>(WorldSlots.Num());
+	WorldSlots.Add(const_cast<UWorld*>(World));
+	WorldSlotLookup.Add(WorldKey, NewSlot);
+	return NewSlot;
+}
+
+UWorld* FObjectProfilerCore::GetOwningWorld(const UObject* Object)
+{
+	TMap<FObjectKey, UWorld*> OuterToWorld;
+	return ResolveOwningWorld(Object, OuterToWorld);
+}
+
+FName FObjectProfilerCore::GetWorldLabel(const UWorld* World)
+{
+	if (!World)
 	{
-		return EObjectCategory::Blueprint;
+		return FName(TEXT("No World"));
 	}
-	if (InClass->IsChildOf(UDataAsset::StaticClass()))
+	
+	switch (World->WorldType)
 	{
-		return EObjectCategory::DataAsset;
+	case EWorldType::Editor:
+		return FName(TEXT("Editor"));
+	case EWorldType::EditorPreview:
+		return FName(TEXT("Editor Preview"));
+	case EWorldType::GamePreview:
+		return FName(TEXT("Game Preview"));
+	case EWorldType::Game:
+		return FName(TEXT("Game"));
+	case EWorldType::Inactive:
+		return FName(TEXT("Inactive"));
+	case EWorldType::PIE:
+		{
+			const int32 PIEInstance = World->GetOutermost()->GetPIEInstanceID();
+			switch (World->GetNetMode())
+			{
+			case NM_DedicatedServer:
+			case NM_ListenServer:
+				return FName(*FString::Printf(TEXT("PIE Server %d"), PIEInstance));
+			case NM_Client:
+				return FName(*FString::Printf(TEXT("PIE Client %d"), PIEInstance));
+			default:
+				return FName(*FString::Printf(TEXT("PIE %d"), PIEInstance));
+			}
+		}
+	default:
+		return FName(TEXT("Other World"));
 	}
-	if (InClass->IsChildOf(USubsystem::StaticClass()))
+}
+
+bool FObjectProfilerCore::MatchesPackagePrefixes(const UPackage* Package, const FProfilerCollectionScope& Scope)
+{
+	if (Scope.PackagePrefixes.Num() == 0)
 	{
-		return EObjectCategory::Subsystem;
+		return true;
 	}
-	if (InClass->IsChildOf(UGameInstance::StaticClass()))
+	
+	if (!Package)
 	{
-		return EObjectCategory::GameInstance;
+		return false;
 	}
-
-	const UPackage* Package = InClass->GetOutermost();
-	if (Package)
+	
+	const FString PackageName = UWorld::RemovePIEPrefix(Package->GetName());
+	for (const FString& Prefix : Scope.PackagePrefixes)
 	{
-		const FString PackageName = Package->GetName();
-		if (PackageName.StartsWith(TEXT("/Game/")) || PackageName.StartsWith(TEXT("/Content/")))
+		if (PackageName.StartsWith(Prefix, ESearchCase::IgnoreCase))
 		{
-			return EObjectCategory::Asset;
+			return true;
 		}
 	}
-
-	return EObjectCategory::Other;
+	
+	return false;
 }
 
-FString FObjectProfilerCore::GetModuleName(const UClass* InClass)
+bool FObjectProfilerCore::MatchesScope(const UObject* Object, const FProfilerCollectionScope& Scope, TMap<const UPackage*, bool>& PackageMatches, TMap<FObjectKey, UWorld*>& OuterToWorld)
 {
-	if (!InClass)
+	if (!IsValid(Object) || Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
 	{
-		return TEXT("Unknown");
+		return false;
 	}
-
-	const UPackage* Package = InClass->GetOutermost();
-	if (!Package)
+	
+	if (Scope.PackagePrefixes.Num() > 0)
 	{
-		return TEXT("Unknown");
+		const UPackage* Package = Object->GetOutermost();
+		bool* CachedMatch = PackageMatches.Find(Package);
+		if (!CachedMatch)
+		{
+			CachedMatch = &PackageMatches.Add(Package, MatchesPackagePrefixes(Package, Scope));
+		}
+		
+		if (!*CachedMatch)
+		{
+			return false;
+		}
 	}
-
-	const FString PackageName = Package->GetName();
 	
-	if (PackageName.StartsWith(TEXT("/Script/")))
+	if (!Scope.World.IsExplicitlyNull())
 	{
-		FString ModuleName = PackageName.RightChop(8);
-		int32 SlashIndex;
-		if (ModuleName.FindChar(TEXT('/'), SlashIndex))
+		const UWorld* ScopeWorld = Scope.World.Get();
+		if (!ScopeWorld || ResolveOwningWorld(Object, OuterToWorld) != ScopeWorld)
 		{
-			ModuleName = ModuleName.Left(SlashIndex);
+			return false;
 		}
-		return ModuleName;
 	}
 	
-	if (PackageName.StartsWith(TEXT("/Game/")))
+	if (!Scope.Outer.IsExplicitlyNull())
 	{
-		return TEXT("Game");
+		const UObject* ScopeOuter = Scope.Outer.Get();
+		if (!ScopeOuter || (Object != ScopeOuter && !Object->IsIn(ScopeOuter)))
+		{
+			return false;
+		}
 	}
 	
-	if (PackageName.StartsWith(TEXT("/Engine/")))
+	return true;
+}
+
+void FObjectProfilerCore::GatherScopedObjects(const FProfilerCollectionScope& Scope, TArray<UObject*>& OutObjects)
+{
+	TMap<const UPackage*, bool> PackageMatches;
+	TMap<FObjectKey, UWorld*> OuterToWorld;
+	
+	auto AddIfMatching = [&](UObject* Obj)
 	{
-		return TEXT("Engine");
+		if (MatchesScope(Obj, Scope, PackageMatches, OuterToWorld))
+		{
+			OutObjects.Add(Obj);
+		}
+	};
+	
+	if (UObject* ScopeOuter = Scope.Outer.Get())
+	{
+		AddIfMatching(ScopeOuter);
+		ForEachObjectWithOuter(ScopeOuter, AddIfMatching, true);
+		return;
 	}
-
-	const int32 FirstSlash = PackageName.Find(TEXT("/"), ESearchCase::IgnoreCase, ESearchDir::FromStart, 1);
-	if (FirstSlash != INDEX_NONE)
+	
+	TArray<UPackage*> Packages;
+	if (UWorld* ScopeWorld = Scope.World.Get())
 	{
-		return PackageName.Mid(1, FirstSlash - 1);
+		Packages.AddUnique(ScopeWorld->GetOutermost());
+		for (ULevel* Level : ScopeWorld->GetLevels())
+		{
+			if (Level)
+			{
+				Packages.AddUnique(Level->GetOutermost());
+			}
+		}
+	}
+	else if (Scope.PackagePrefixes.Num() > 0)
+	{
+		ForEachObjectOfClass(UPackage::StaticClass(), [&Packages, &Scope](UObject* PackageObj)
+		{
+			UPackage* Package = static_cast<UPackage*>(PackageObj);
+			if (MatchesPackagePrefixes(Package, Scope))
+			{
+				Packages.Add(Package);
+			}
+		}, false);
+	}
+	
+	for (UPackage* Package : Packages)
+	{
+		AddIfMatching(Package);
+		ForEachObjectWithPackage(Package, [&AddIfMatching](UObject* Obj)
+		{
+			AddIfMatching(Obj);
+			return true;
+		}, true);
 	}
-
-	return TEXT("Other");
 }
 
-EObjectSource FObjectProfilerCore::GetObjectSource(const UClass* InClass)
+FString FObjectProfilerCore::DescribeScope(const FProfilerCollectionScope& Scope)
+{
+	TArray<FString> Parts;
+	
+	if (Scope.PackagePrefixes.Num() > 0)
+	{
+		Parts.Add(FString::Join(Scope.PackagePrefixes, TEXT(", ")));
+	}
+	if (!Scope.World.IsExplicitlyNull())
+	{
+		Parts.Add(FString::Printf(TEXT("World %s"), Scope.World.IsValid() ? *GetWorldLabel(Scope.World.Get()).ToString() : TEXT("(destroyed)")));
+	}
+	if (!Scope.Outer.IsExplicitlyNull())
+	{
+		Parts.Add(FString::Printf(TEXT("Outer %s"), Scope.Outer.IsValid() ? *Scope.Outer->GetName() : TEXT("(destroyed)")));
+	}
+	
+	return Parts.Num() > 0 ? FString::Join(Parts, TEXT(" | ")) : TEXT("Everything");
+}
+
+bool FObjectProfilerCore::GetScopeWorldLabel(const FProfilerCollectionScope& Scope, FName& OutWorldLabel)
+{
+	OutWorldLabel = NAME_None;
+	
+	if (Scope.IsEmpty())
+	{
+		return true;
+	}
+	
+	if (Scope.PackagePrefixes.Num() > 0 || !Scope.Outer.IsExplicitlyNull() || !Scope.World.IsValid())
+	{
+		return false;
+	}
+	
+	OutWorldLabel = GetWorldLabel(Scope.World.Get());
+	return true;
+}
+
+void FObjectProfilerCore::ProjectStatsToWorld(TArray<TSharedPtr<FObjectClassStats>>& Stats, FName WorldLabel)
+{
+	Stats.RemoveAll([WorldLabel](const TSharedPtr<FObjectClassStats>& ClassStats)
+	{
+		const FObjectWorldStats* WorldStats = ClassStats->WorldStats.Find(WorldLabel);
+		return !WorldStats || WorldStats->InstanceCount <= 0;
+	});
+	
+	for (TSharedPtr<FObjectClassStats>& ClassStats : Stats)
+	{
+		const FObjectWorldStats WorldStats = ClassStats->WorldStats.FindChecked(WorldLabel);
+		ClassStats->InstanceCount = WorldStats.InstanceCount;
+		ClassStats->TotalSizeBytes = WorldStats.TotalSizeBytes;
+		ClassStats->WorldStats.Reset();
+		ClassStats->WorldStats.Add(WorldLabel, WorldStats);
+	}
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::CollectScopedStats(const FProfilerCollectionScope& Scope, int32 MaxSamplesPerClass)
+{
+	TArray<UObject*> ScopedObjects;
+	GatherScopedObjects(Scope, ScopedObjects);
+	
+	TMap<UClass*, TSharedPtr<FObjectClassStats>> StatsMap;
+	FWorldResolveCache WorldCache;
+	FLargestObjectsList LargestObjects;
+	
+	for (UObject* Obj : ScopedObjects)
+	{
+		AccumulateObject(FindOrAddClassStats(StatsMap, Obj->GetClass()), Obj, WorldCache, 1, MaxSamplesPerClass, true, &LargestObjects);
+	}
+	
+	LatestLargestObjects = LargestObjects.GetSorted();
+	
+	TArray<TSharedPtr<FObjectClassStats>> Result;
+	StatsMap.GenerateValueArray(Result);
+	return Result;
+}
+
+void FObjectProfilerCore::RefreshGarbageCollectBinding()
+{
+	const bool bNeedsBinding = bIncrementalTrackingActive || AsyncState.Phase != EAsyncPhase::Idle;
+	
+	if (bNeedsBinding && !PostGarbageCollectHandle.IsValid())
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FObjectProfilerCore::OnPostGarbageCollect);
+	}
+	else if (!bNeedsBinding && PostGarbageCollectHandle.IsValid())
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		PostGarbageCollectHandle.Reset();
+	}
+}
+
+void FObjectProfilerCore::OnPostGarbageCollect()
+{
+	AsyncState.WorldCache.Reset();
+	
+	FScopeLock Lock(&IncrementalDataLock);
+	IncrementalOuterToWorld.Reset();
+	
+	for (auto It = WorldSlotLookup.CreateIterator(); It; ++It)
+	{
+		if (!WorldSlots[It.Value()].IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+EObjectCategory FObjectProfilerCore::CategorizeClass(const UClass* InClass)
+{
+	if (!InClass)
+	{
+		return EObjectCategory::Unknown;
+	}
+
+	if (InClass->IsChildOf(AActor::StaticClass()))
+	{
+		return EObjectCategory::Actor;
+	}
+	if (InClass->IsChildOf(UActorComponent::StaticClass()))
+	{
+		return EObjectCategory::Component;
+	}
+	if (InClass->IsChildOf(UUserWidget::StaticClass()))
+	{
+		return EObjectCategory::Widget;
+	}
+	if (InClass->IsChildOf(UTexture::StaticClass()))
+	{
+		return EObjectCategory::Texture;
+	}
+	if (InClass->IsChildOf(UStaticMesh::StaticClass()) || InClass->IsChildOf(USkeletalMesh::StaticClass()))
+	{
+		return EObjectCategory::Mesh;
+	}
+	if (InClass->IsChildOf(UMaterialInterface::StaticClass()))
+	{
+		return EObjectCategory::Material;
+	}
+	if (InClass->IsChildOf(USoundBase::StaticClass()))
+	{
+		return EObjectCategory::Audio;
+	}
+	if (InClass->IsChildOf(UAnimationAsset::StaticClass()))
+	{
+		return EObjectCategory::Animation;
+	}
+	if (InClass->IsChildOf(UBlueprint::StaticClass()))
+	{
+		return EObjectCategory::Blueprint;
+	}
+	if (InClass->IsChildOf(UDataAsset::StaticClass()))
+	{
+		return EObjectCategory::DataAsset;
+	}
+	if (InClass->IsChildOf(USubsystem::StaticClass()))
+	{
+		return EObjectCategory::Subsystem;
+	}
+	if (InClass->IsChildOf(UGameInstance::StaticClass()))
+	{
+		return EObjectCategory::GameInstance;
+	}
+
+	const UPackage* Package = InClass->GetOutermost();
+	if (Package)
+	{
+		const FString PackageName = Package->GetName();
+		if (PackageName.StartsWith(TEXT("/Game/")) || PackageName.StartsWith(TEXT("/Content/")))
+		{
+			return EObjectCategory::Asset;
+		}
+	}
+
+	return EObjectCategory::Other;
+}
+
+FString FObjectProfilerCore::GetModuleName(const UClass* InClass)
+{
+	if (!InClass)
+	{
+		return TEXT("Unknown");
+	}
+
+	const UPackage* Package = InClass->GetOutermost();
+	if (!Package)
+	{
+		return TEXT("Unknown");
+	}
+
+	const FString PackageName = Package->GetName();
+	
+	if (PackageName.StartsWith(TEXT("/Script/")))
+	{
+		FString ModuleName = PackageName.RightChop(8);
+		int32 SlashIndex;
+		if (ModuleName.FindChar(TEXT('/'), SlashIndex))
+		{
+			ModuleName = ModuleName.Left(SlashIndex);
+		}
+		return ModuleName;
+	}
+	
+	if (PackageName.StartsWith(TEXT("/Game/")))
+	{
+		return TEXT("Game");
+	}
+	
+	if (PackageName.StartsWith(TEXT("/Engine/")))
+	{
+		return TEXT("Engine");
+	}
+
+	const int32 FirstSlash = PackageName.Find(TEXT("/"), ESearchCase::IgnoreCase, ESearchDir::FromStart, 1);
+	if (FirstSlash != INDEX_NONE)
+	{
+		return PackageName.Mid(1, FirstSlash - 1);
+	}
+
+	return TEXT("Other");
+}
+
+EObjectSource FObjectProfilerCore::GetObjectSource(const UClass* InClass)
 {
 	if (!InClass)
 	{
@@ -520,128 +1114,172 @@ FString FObjectProfilerCore::GetSourceDisplayName(EObjectSource Source)
 	}
 }
 
+FString FObjectProfilerCore::GetCategoryDisplayName(EObjectCategory Category)
+{
+	switch (Category)
+	{
+	case EObjectCategory::Actor:
+		return TEXT("Actors");
+	case EObjectCategory::Component:
+		return TEXT("Components");
+	case EObjectCategory::Asset:
+		return TEXT("Assets");
+	case EObjectCategory::Widget:
+		return TEXT("Widgets");
+	case EObjectCategory::Animation:
+		return TEXT("Animation");
+	case EObjectCategory::Audio:
+		return TEXT("Audio");
+	case EObjectCategory::Material:
+		return TEXT("Materials");
+	case EObjectCategory::Texture:
+		return TEXT("Textures");
+	case EObjectCategory::Mesh:
+		return TEXT("Meshes");
+	case EObjectCategory::Blueprint:
+		return TEXT("Blueprints");
+	case EObjectCategory::DataAsset:
+		return TEXT("Data Assets");
+	case EObjectCategory::Subsystem:
+		return TEXT("Subsystems");
+	case EObjectCategory::GameInstance:
+		return TEXT("Game Instance");
+	case EObjectCategory::Other:
+		return TEXT("Other");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
 TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::CollectObjectStats(int32 MaxSamplesPerClass)
 {
-	TMap<UClass*, TSharedPtr<FObjectClassStats>> StatsMap;
-	const double CurrentTime = FPlatformTime::Seconds();
+	return GetDefaultSession()->CollectNow(MaxSamplesPerClass, true);
+}
 
-	int32 TotalObjects = 0;
-	for (TObjectIterator<UObject> It; It; ++It)
+void FObjectProfilerCore::CollectObjectStatsAsync(
+	int32 MaxSamplesPerClass,
+	FOnObjectStatsCollected OnComplete,
+	FOnCollectionProgress OnProgress,
+	const FProfilerCollectionScope& Scope,
+	FOnPartialResults OnPartialResults)
+{
+	CollectObjectStatsAsync(GetDefaultSession(), Scope, MaxSamplesPerClass, OnComplete, OnProgress, OnPartialResults);
+}
+
+void FObjectProfilerCore::CollectObjectStatsAsync(
+	const TSharedRef<FObjectProfilerSession>& Session,
+	const FProfilerCollectionScope& Scope,
+	int32 MaxSamplesPerClass,
+	FOnObjectStatsCollected OnComplete,
+	FOnCollectionProgress OnProgress,
+	FOnPartialResults OnPartialResults)
+{
+	if (AsyncState.Phase != EAsyncPhase::Idle && IsSameCollection(AsyncState.Session, AsyncState.Scope, Session, Scope))
 	{
-		TotalObjects++;
+		AsyncState.Consumers.Add(OnComplete);
+		return;
 	}
-
-	FScopedSlowTask SlowTask(TotalObjects, FText::FromString(TEXT("Collecting object statistics...")));
-	SlowTask.MakeDialog(true);
-
-	for (TObjectIterator<UObject> It; It; ++It)
+	
+	for (FQueuedCollection& Queued : QueuedCollections)
 	{
-		if (SlowTask.ShouldCancel())
-		{
-			break;
-		}
-
-		SlowTask.EnterProgressFrame(1);
-
-		UObject* Obj = *It;
-		if (!IsValid(Obj))
+		if (IsSameCollection(Queued.Session, Queued.Scope, Session, Scope))
 		{
-			continue;
-		}
-
-		if (Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
-		{
-			continue;
+			Queued.Consumers.Add(OnComplete);
+			Queued.MaxSamplesPerClass = FMath::Max(Queued.MaxSamplesPerClass, MaxSamplesPerClass);
+			Queued.OnProgress = OnProgress;
+			Queued.OnPartialResults = OnPartialResults;
+			return;
 		}
+	}
+	
+	FQueuedCollection Request;
+	Request.Session = Session;
+	Request.Scope = Scope;
+	Request.MaxSamplesPerClass = MaxSamplesPerClass;
+	Request.Consumers.Add(OnComplete);
+	Request.OnProgress = OnProgress;
+	Request.OnPartialResults = OnPartialResults;
+	
+	if (AsyncState.Phase != EAsyncPhase::Idle)
+	{
+		QueuedCollections.Add(MoveTemp(Request));
+		return;
+	}
+	
+	BeginCollection(Request);
+}
 
-		UClass* ObjClass = Obj->GetClass();
-
-		TSharedPtr<FObjectClassStats>& StatsPtr = StatsMap.FindOrAdd(ObjClass);
-		
-		if (!StatsPtr.IsValid())
-		{
-			StatsPtr = MakeShared<FObjectClassStats>();
-			StatsPtr->ClassName = ObjClass->GetName();
-			StatsPtr->ClassFName = ObjClass->GetFName();
-			StatsPtr->ClassPtr = ObjClass;
-			StatsPtr->Category = CategorizeClass(ObjClass);
-			StatsPtr->Source = GetObjectSource(ObjClass);
-			StatsPtr->ModuleName = GetModuleName(ObjClass);
-			StatsPtr->bSizeAvailable = false;
-		}
-		
-		FObjectClassStats& Stats = *StatsPtr;
-		Stats.InstanceCount++;
+bool FObjectProfilerCore::IsSameCollection(const TWeakPtr<FObjectProfilerSession>& Session, const FProfilerCollectionScope& Scope, const TSharedRef<FObjectProfilerSession>& OtherSession, const FProfilerCollectionScope& OtherScope)
+{
+	return Session.Pin() == OtherSession
+		&& FObjectProfilerSession::MakeHistoryKey(Scope) == FObjectProfilerSession::MakeHistoryKey(OtherScope);
+}
 
-		const bool bSafeForThisObject = IsSafeForResourceSizeQuery(Obj);
+void FObjectProfilerCore::StartNextQueuedCollection()
+{
+	while (QueuedCollections.Num() > 0 && AsyncState.Phase == EAsyncPhase::Idle)
+	{
+		FQueuedCollection Request = MoveTemp(QueuedCollections[0]);
+		QueuedCollections.RemoveAt(0);
 		
-		if (bSafeForThisObject)
-		{
-			Stats.TotalSizeBytes += Obj->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
-			Stats.bSizeAvailable = true;
-		}
-
-		if (Stats.SampleObjectNames.Num() < MaxSamplesPerClass)
+		if (Request.Session.IsValid())
 		{
-			Stats.SampleObjectNames.Add(Obj->GetPathName());
+			BeginCollection(Request);
 		}
 	}
+}
 
-	TArray<TSharedPtr<FObjectClassStats>> Result;
-	StatsMap.GenerateValueArray(Result);
-
-	for (auto& Stats : Result)
+void FObjectProfilerCore::BeginCollection(FQueuedCollection& Request)
+{
+	const FProfilerCollectionScope& Scope = Request.Scope;
+	
+	AsyncState.Reset();
+	bCancellationRequested = false;
+	
+	AsyncState.Session = Request.Session;
+	AsyncState.MaxSamplesPerClass = Request.MaxSamplesPerClass;
+	AsyncState.Consumers = MoveTemp(Request.Consumers);
+	AsyncState.OnProgress = Request.OnProgress;
+	AsyncState.OnPartialResults = Request.OnPartialResults;
+	AsyncState.bDeferredSizing = CollectionSizing == ECollectionSizing::Deferred || FObjectProfilerGovernor::ShouldDeferSizing();
+	AsyncState.LastPartialPublishTime = FPlatformTime::Seconds();
+	AsyncState.Phase = EAsyncPhase::Enumerating;
+	
+	StartCollectionJournal();
+	
+	if (!Scope.IsEmpty())
 	{
-		if (Stats->InstanceCount > 0 && Stats->bSizeAvailable && Stats->TotalSizeBytes > 0)
-		{
-			Stats->AverageSizeBytes = Stats->TotalSizeBytes / Stats->InstanceCount;
-		}
+		TArray<UObject*> ScopedObjects;
+		GatherScopedObjects(Scope, ScopedObjects);
 		
-		Stats->AddHistoryPoint(Stats->InstanceCount, Stats->TotalSizeBytes, CurrentTime);
+		AsyncState.Scope = Scope;
+		AsyncState.bScoped = true;
+		AsyncState.TotalObjectsEstimate = ScopedObjects.Num();
+		AsyncState.ObjectsToProcess.Reserve(ScopedObjects.Num());
+		AsyncState.ScopedObjectClasses.Reserve(ScopedObjects.Num());
 		
-		if (const TSharedPtr<FObjectClassStats>* PrevStats = PreviousStats.Find(Stats->ClassName))
+		for (UObject* Obj : ScopedObjects)
 		{
-			Stats->DeltaCount = Stats->InstanceCount - (*PrevStats)->InstanceCount;
-			Stats->DeltaSizeBytes = Stats->TotalSizeBytes - (*PrevStats)->TotalSizeBytes;
-			
-			Stats->History = (*PrevStats)->History;
-			Stats->AddHistoryPoint(Stats->InstanceCount, Stats->TotalSizeBytes, CurrentTime);
-			Stats->UpdateLeakDetection(LeakDetectionThreshold);
-			Stats->CalculateRateOfChange();
+			AsyncState.ObjectsToProcess.Add(Obj);
+			AsyncState.ScopedObjectClasses.Add(Obj->GetClass());
 		}
 		
-		PreviousStats.Add(Stats->ClassName, Stats);
+		AsyncState.Phase = EAsyncPhase::Processing;
+		
+		UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Scoped collection over %d objects (%s)"), ScopedObjects.Num(), *DescribeScope(Scope));
 	}
-
-	return Result;
-}
-
-void FObjectProfilerCore::CollectObjectStatsAsync(
-	int32 MaxSamplesPerClass,
-	FOnObjectStatsCollected OnComplete,
-	FOnCollectionProgress OnProgress)
-{
-	if (AsyncState.Phase != EAsyncPhase::Idle)
+	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ObjectProfiler: Async collection already in progress"));
-		return;
+		AsyncState.TotalObjectsEstimate = GetTotalObjectCount();
+		AsyncState.ObjectsToProcess.Reserve(AsyncState.TotalObjectsEstimate);
 	}
 
-	AsyncState.Reset();
-	bCancellationRequested = false;
-	
-	AsyncState.MaxSamplesPerClass = MaxSamplesPerClass;
-	AsyncState.OnComplete = OnComplete;
-	AsyncState.OnProgress = OnProgress;
-	AsyncState.Phase = EAsyncPhase::Enumerating;
-	
-	AsyncState.TotalObjectsEstimate = GetTotalObjectCount();
-	AsyncState.ObjectsToProcess.Reserve(AsyncState.TotalObjectsEstimate);
-
 	AsyncState.TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
 		FTickerDelegate::CreateStatic(&FObjectProfilerCore::OnAsyncTick),
 		0.0f
 	);
+	
+	RefreshGarbageCollectBinding();
 }
 
 void FObjectProfilerCore::CancelAsyncCollection()
@@ -656,10 +1294,15 @@ bool FObjectProfilerCore::IsAsyncCollectionInProgress()
 
 bool FObjectProfilerCore::OnAsyncTick(float DeltaTime)
 {
+	FScopedProfilerCost Cost(EProfilerCostBucket::AsyncCollection);
+	
 	if (bCancellationRequested)
 	{
+		StopCollectionJournal();
 		AsyncState.Reset();
 		bCancellationRequested = false;
+		RefreshGarbageCollectBinding();
+		StartNextQueuedCollection();
 		return false;
 	}
 
@@ -673,6 +1316,10 @@ bool FObjectProfilerCore::OnAsyncTick(float DeltaTime)
 		TickProcessing();
 		break;
 		
+	case EAsyncPhase::Sizing:
+		TickSizing();
+		break;
+		
 	case EAsyncPhase::Complete:
 		FinalizeCollection();
 		return false;
@@ -689,7 +1336,7 @@ void FObjectProfilerCore::TickEnumeration()
 	const int32 MaxObjectIndex = GUObjectArray.GetObjectArrayNum();
 	int32 ProcessedThisTick = 0;
 	
-	while (AsyncState.EnumerationIndex < MaxObjectIndex && ProcessedThisTick < EnumerationChunkSize)
+	while (AsyncState.EnumerationIndex < MaxObjectIndex && ProcessedThisTick < FObjectProfilerGovernor::ScaleWorkChunk(EnumerationChunkSize))
 	{
 		FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(AsyncState.EnumerationIndex);
 		AsyncState.EnumerationIndex++;
@@ -709,6 +1356,10 @@ void FObjectProfilerCore::TickEnumeration()
 		{
 			AsyncState.ObjectsToProcess.Add(Obj);
 		}
+		else if (Obj && ObjectItem->IsGarbage())
+		{
+			RecordGarbageObject(AsyncState.StatsMap, Obj);
+		}
 		
 		ProcessedThisTick++;
 	}
@@ -721,271 +1372,1004 @@ void FObjectProfilerCore::TickEnumeration()
 		AsyncState.OnProgress.Execute(FMath::Clamp(Progress, 0.0f, EnumerationWeight));
 	}
 
-	if (AsyncState.EnumerationIndex >= MaxObjectIndex)
+	if (AsyncState.EnumerationIndex >= MaxObjectIndex)
+	{
+		AsyncState.Phase = EAsyncPhase::Processing;
+	}
+}
+
+void FObjectProfilerCore::TickProcessing()
+{
+	const int32 TotalObjects = AsyncState.ObjectsToProcess.Num();
+	const int32 ChunkSize = FObjectProfilerGovernor::ScaleWorkChunk(AsyncState.bDeferredSizing ? CountingChunkSize : ProcessingChunkSize);
+	const int32 EndIndex = FMath::Min(AsyncState.ProcessingIndex + ChunkSize, TotalObjects);
+	TArray<int32, TInlineAllocator<ProcessingChunkSize>> CountedIndices;
+
+	for (int32 i = AsyncState.ProcessingIndex; i < EndIndex; ++i)
+	{
+		UObject* Obj = AsyncState.ObjectsToProcess[i].Get();
+		if (!IsValid(Obj))
+		{
+			if (AsyncState.bScoped && CollectionConsistency == ECollectionConsistency::CollectionStart)
+			{
+				if (UClass* GoneClass = AsyncState.ScopedObjectClasses[i].Get())
+				{
+					FindOrAddClassStats(AsyncState.StatsMap, GoneClass).InstanceCount++;
+				}
+			}
+			continue;
+		}
+
+		UClass* ObjClass = Obj->GetClass();
+		if (!ObjClass)
+		{
+			continue;
+		}
+
+		AccumulateObject(FindOrAddClassStats(AsyncState.StatsMap, ObjClass), Obj, AsyncState.WorldCache, 1, AsyncState.MaxSamplesPerClass, !AsyncState.bDeferredSizing, &AsyncState.LargestObjects);
+		CountedIndices.Add(GUObjectArray.ObjectToIndex(Obj));
+		
+		if (AsyncState.bDeferredSizing)
+		{
+			AsyncState.SizingBuckets.FindOrAdd(ObjClass).Add(i);
+		}
+	}
+
+	AsyncState.ProcessingIndex = EndIndex;
+	
+	{
+		FScopeLock Lock(&JournalLock);
+		for (const int32 CountedIndex : CountedIndices)
+		{
+			if (CountedIndex >= JournalCountedIndices.Num())
+			{
+				JournalCountedIndices.Add(false, CountedIndex + 1 - JournalCountedIndices.Num());
+			}
+			JournalCountedIndices[CountedIndex] = true;
+		}
+	}
+
+	constexpr float EnumerationWeight = 0.2f;
+	const float ProcessingWeight = AsyncState.bDeferredSizing ? 0.2f : 0.8f;
+	const float Progress = TotalObjects > 0
+		? FMath::Clamp(EnumerationWeight + ProcessingWeight * (static_cast<float>(AsyncState.ProcessingIndex) / static_cast<float>(TotalObjects)), 0.0f, 1.0f)
+		: 1.0f;
+
+	if (AsyncState.OnProgress.IsBound() && TotalObjects > 0)
+	{
+		AsyncState.OnProgress.Execute(Progress);
+	}
+
+	if (AsyncState.ProcessingIndex >= TotalObjects)
+	{
+		if (AsyncState.bDeferredSizing)
+		{
+			BeginSizingPhase();
+		}
+		else
+		{
+			AsyncState.Phase = EAsyncPhase::Complete;
+		}
+	}
+	else if (AsyncState.OnPartialResults.IsBound())
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		if (CurrentTime - AsyncState.LastPartialPublishTime >= PartialResultsIntervalSeconds)
+		{
+			AsyncState.LastPartialPublishTime = CurrentTime;
+			PublishPartialResults(Progress, PartialResultsMaxClasses);
+		}
+	}
+}
+
+void FObjectProfilerCore::BeginSizingPhase()
+{
+	const TSharedPtr<FObjectProfilerSession> Session = AsyncState.Session.Pin();
+	
+	TMap<UClass*, int64> ExpectedSizes;
+	for (const auto& Pair : AsyncState.SizingBuckets)
+	{
+		const TSharedPtr<FObjectClassStats> Stats = AsyncState.StatsMap.FindRef(Pair.Key);
+		if (!Stats.IsValid())
+		{
+			continue;
+		}
+		
+		const TSharedPtr<FObjectClassStats> PrevStats = Session.IsValid() ? Session->FindPreviousStats(Stats->ClassName, AsyncState.Scope) : TSharedPtr<FObjectClassStats>();
+		const int64 ExpectedSize = (PrevStats.IsValid() && PrevStats->bSizeAvailable)
+			? PrevStats->TotalSizeBytes
+			: static_cast<int64>(Stats->InstanceCount) * Pair.Key->GetPropertiesSize();
+		
+		ExpectedSizes.Add(Pair.Key, ExpectedSize);
+		Stats->bSizePending = true;
+	}
+	
+	AsyncState.SizingBuckets.GenerateKeyArray(AsyncState.SizingClassOrder);
+	AsyncState.SizingClassOrder.Sort([&ExpectedSizes](const UClass& A, const UClass& B)
+	{
+		return ExpectedSizes.FindRef(&A) > ExpectedSizes.FindRef(&B);
+	});
+	
+	AsyncState.SizingOrder.Reserve(AsyncState.ProcessingIndex);
+	AsyncState.SizingClassEnds.Reserve(AsyncState.SizingClassOrder.Num());
+	for (UClass* SizingClass : AsyncState.SizingClassOrder)
+	{
+		AsyncState.SizingOrder.Append(AsyncState.SizingBuckets.FindChecked(SizingClass));
+		AsyncState.SizingClassEnds.Add(AsyncState.SizingOrder.Num());
+	}
+	
+	AsyncState.SizingBuckets.Empty();
+	AsyncState.SizingIndex = 0;
+	AsyncState.SizingClassCursor = 0;
+	AsyncState.Phase = AsyncState.SizingOrder.Num() > 0 ? EAsyncPhase::Sizing : EAsyncPhase::Complete;
+	
+	if (AsyncState.Phase == EAsyncPhase::Sizing && AsyncState.OnPartialResults.IsBound())
+	{
+		AsyncState.LastPartialPublishTime = FPlatformTime::Seconds();
+		PublishPartialResults(0.4f, MAX_int32);
+	}
+}
+
+void FObjectProfilerCore::TickSizing()
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 TotalToSize = AsyncState.SizingOrder.Num();
+	
+	while (AsyncState.SizingIndex < TotalToSize)
+	{
+		UClass* SizingClass = AsyncState.SizingClassOrder[AsyncState.SizingClassCursor];
+		FSizingTally& Tally = AsyncState.SizingTallies.FindOrAdd(SizingClass);
+		UObject* Obj = AsyncState.ObjectsToProcess[AsyncState.SizingOrder[AsyncState.SizingIndex]].Get();
+		AsyncState.SizingIndex++;
+		
+		if (!IsValid(Obj) || Obj->GetClass() != SizingClass)
+		{
+			Tally.Missing++;
+		}
+		else if (IsSafeForResourceSizeQuery(Obj))
+		{
+			FObjectClassStats& Stats = *AsyncState.StatsMap.FindChecked(SizingClass);
+			RecordObjectSize(Stats, Obj, MeasureObjectSize(Obj), 1, AsyncState.WorldCache, &AsyncState.LargestObjects);
+			Tally.Sized++;
+		}
+		
+		while (AsyncState.SizingClassCursor < AsyncState.SizingClassOrder.Num() &&
+			AsyncState.SizingIndex >= AsyncState.SizingClassEnds[AsyncState.SizingClassCursor])
+		{
+			FinishSizedClass(AsyncState.SizingClassOrder[AsyncState.SizingClassCursor]);
+			AsyncState.SizingClassCursor++;
+		}
+		
+		if ((AsyncState.SizingIndex & 31) == 0 && FPlatformTime::Seconds() - StartTime >= FObjectProfilerGovernor::ScaleWorkBudget(SizingBudgetSeconds))
+		{
+			break;
+		}
+	}
+	
+	constexpr float CountedWeight = 0.4f;
+	constexpr float SizingWeight = 0.6f;
+	const float Progress = FMath::Clamp(CountedWeight + SizingWeight * 
+		(static_cast<float>(AsyncState.SizingIndex) / static_cast<float>(FMath::Max(TotalToSize, 1))), 0.0f, 1.0f);
+	
+	if (AsyncState.OnProgress.IsBound())
+	{
+		AsyncState.OnProgress.Execute(Progress);
+	}
+	
+	if (AsyncState.SizingIndex >= TotalToSize)
+	{
+		AsyncState.Phase = EAsyncPhase::Complete;
+	}
+	else if (AsyncState.OnPartialResults.IsBound())
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		if (CurrentTime - AsyncState.LastPartialPublishTime >= PartialResultsIntervalSeconds)
+		{
+			AsyncState.LastPartialPublishTime = CurrentTime;
+			PublishPartialResults(Progress, MAX_int32);
+		}
+	}
+}
+
+void FObjectProfilerCore::FinishSizedClass(UClass* SizedClass)
+{
+	const TSharedPtr<FObjectClassStats> Stats = AsyncState.StatsMap.FindRef(SizedClass);
+	if (!Stats.IsValid())
+	{
+		return;
+	}
+	
+	const FSizingTally* Tally = AsyncState.SizingTallies.Find(SizedClass);
+	if (Tally && Tally->Sized > 0 && Tally->Missing > 0)
+	{
+		Stats->TotalSizeBytes += Stats->TotalSizeBytes / Tally->Sized * Tally->Missing;
+	}
+	
+	Stats->bSizePending = false;
+	if (Stats->InstanceCount > 0 && Stats->bSizeAvailable)
+	{
+		Stats->AverageSizeBytes = Stats->TotalSizeBytes / Stats->InstanceCount;
+	}
+}
+
+void FObjectProfilerCore::PublishPartialResults(float Progress, int32 MaxClasses)
+{
+	TArray<const FObjectClassStats*> Ranked;
+	Ranked.Reserve(AsyncState.StatsMap.Num());
+	
+	for (const auto& Pair : AsyncState.StatsMap)
+	{
+		if (Pair.Value.IsValid() && Pair.Value->InstanceCount > 0)
+		{
+			Ranked.Add(Pair.Value.Get());
+		}
+	}
+	
+	Ranked.Sort([](const FObjectClassStats& A, const FObjectClassStats& B)
+	{
+		return A.InstanceCount > B.InstanceCount;
+	});
+	
+	const int32 NumToPublish = FMath::Min(Ranked.Num(), MaxClasses);
+	TArray<TSharedPtr<FObjectClassStats>> Partial;
+	Partial.Reserve(NumToPublish);
+	
+	for (int32 i = 0; i < NumToPublish; ++i)
+	{
+		TSharedPtr<FObjectClassStats> Copy = MakeShared<FObjectClassStats>(*Ranked[i]);
+		if (Copy->bSizeAvailable && Copy->TotalSizeBytes > 0)
+		{
+			Copy->AverageSizeBytes = Copy->TotalSizeBytes / Copy->InstanceCount;
+		}
+		Partial.Add(Copy);
+	}
+	
+	ComputeHierarchyRollups(Partial);
+	AsyncState.OnPartialResults.Execute(Partial, Progress);
+}
+
+FObjectClassStats& FObjectProfilerCore::FindOrAddClassStats(TMap<UClass*, TSharedPtr<FObjectClassStats>>& StatsMap, UClass* ObjClass)
+{
+	TSharedPtr<FObjectClassStats>& StatsPtr = StatsMap.FindOrAdd(ObjClass);
+	
+	if (!StatsPtr.IsValid())
+	{
+		StatsPtr = MakeShared<FObjectClassStats>();
+		StatsPtr->ClassName = ObjClass->GetName();
+		StatsPtr->ClassFName = ObjClass->GetFName();
+		StatsPtr->ClassPtr = ObjClass;
+		StatsPtr->Category = CategorizeClass(ObjClass);
+		StatsPtr->Source = GetObjectSource(ObjClass);
+		StatsPtr->ModuleName = GetModuleName(ObjClass);
+		StatsPtr->bSizeAvailable = false;
+	}
+	
+	return *StatsPtr;
+}
+
+void FObjectProfilerCore::AccumulateObject(FObjectClassStats& Stats, UObject* Obj, FWorldResolveCache& WorldCache, int32 Sign, int32 MaxSamples, bool bMeasureSize, FLargestObjectsList* LargestObjects)
+{
+	Stats.InstanceCount += Sign;
+	Stats.WorldStats.FindOrAdd(ResolveWorldLabel(Obj, WorldCache)).InstanceCount += Sign;
+	Stats.PackageStats.FindOrAdd(ResolvePackageLabel(Obj)).InstanceCount += Sign;
+	Stats.OuterStats.FindOrAdd(FObjectKey(Obj->GetOuter())).InstanceCount += Sign;
+	RecordObjectFlags(Stats.FlagCensus, Obj, Sign);
+
+	if (bMeasureSize && IsSafeForResourceSizeQuery(Obj))
+	{
+		RecordObjectSize(Stats, Obj, MeasureObjectSize(Obj), Sign, WorldCache, LargestObjects);
+	}
+
+	if (Sign > 0 && Stats.SampleObjectNames.Num() < MaxSamples)
+	{
+		Stats.SampleObjectNames.Add(Obj->GetPathName());
+	}
+}
+
+void FObjectProfilerCore::RecordObjectSize(FObjectClassStats& Stats, const UObject* Obj, const FObjectSizeBreakdown& Breakdown, int32 Sign, FWorldResolveCache& WorldCache, FLargestObjectsList* LargestObjects)
+{
+	const int64 Size = Breakdown.GetTotal();
+	Stats.TotalSizeBytes += Size * Sign;
+	Stats.SizeBreakdown.Add(Breakdown, Sign);
+	Stats.WorldStats.FindOrAdd(ResolveWorldLabel(Obj, WorldCache)).TotalSizeBytes += Size * Sign;
+	Stats.PackageStats.FindOrAdd(ResolvePackageLabel(Obj)).TotalSizeBytes += Size * Sign;
+	Stats.OuterStats.FindOrAdd(FObjectKey(Obj->GetOuter())).TotalSizeBytes += Size * Sign;
+	Stats.bSizeAvailable = true;
+	
+	FObjectSizeDistribution& Distribution = Stats.SizeDistribution;
+	Distribution.AddSample(Size, Sign);
+	
+	if (Sign > 0 && Distribution.WouldKeepInstance(Size))
+	{
+		Distribution.OfferInstance(Obj->GetPathName(), Size);
+	}
+	else if (Sign < 0 && Distribution.LargestInstances.Num() > 0 && Size >= Distribution.LargestInstances.HeapTop().SizeBytes)
+	{
+		Distribution.RemoveInstance(Obj->GetPathName());
+	}
+	
+	if (LargestObjects)
+	{
+		TrackLargestObject(*LargestObjects, Obj, Size, Sign, WorldCache);
+	}
+}
+
+void FObjectProfilerCore::RecordObjectFlags(FObjectFlagCensus& Census, const UObject* Obj, int32 Sign)
+{
+	if (Obj->IsRooted())
+	{
+		Census.RootSet += Sign;
+	}
+	if (Obj->HasAnyFlags(RF_Transient))
+	{
+		Census.Transient += Sign;
+	}
+	if (Obj->GetPackage() == GetTransientPackage())
+	{
+		Census.TransientPackage += Sign;
+	}
+	if (Obj->HasAnyFlags(RF_NeedLoad | RF_NeedPostLoad | RF_WillBeLoaded))
+	{
+		Census.AsyncLoading += Sign;
+	}
+	if (Obj->HasAnyFlags(RF_Standalone))
+	{
+		Census.Standalone += Sign;
+	}
+	if (Obj->HasAnyFlags(RF_Public))
+	{
+		Census.Public += Sign;
+	}
+}
+
+void FObjectProfilerCore::RecordGarbageObject(TMap<UClass*, TSharedPtr<FObjectClassStats>>& StatsMap, const UObject* Obj)
+{
+	if (!Obj || Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		return;
+	}
+	
+	if (UClass* ObjClass = Obj->GetClass())
+	{
+		FindOrAddClassStats(StatsMap, ObjClass).FlagCensus.Garbage++;
+	}
+}
+
+int64 FObjectProfilerCore::GetObjectSize(UObject* Obj)
+{
+	return IsSafeForResourceSizeQuery(Obj) ? MeasureObjectSize(Obj).GetTotal() : 0;
+}
+
+int32 FObjectProfilerCore::GetSparseCapacity(const void* SetPtr)
+{
+	// TSet and TMap both start with their sparse element array, which starts with its data array.
+	const FScriptArray* ElementData = static_cast<const FScriptArray*>(SetPtr);
+	return ElementData->Num() + ElementData->GetSlack();
+}
+
+int64 FObjectProfilerCore::GetHashBytes(int32 NumElements)
+{
+	// The hash is rehashed up to the bucket count of the peak element count, and a single bucket lives inline.
+	const int64 NumBuckets = FDefaultSetAllocator::GetNumberOfHashBuckets(static_cast<uint32>(NumElements));
+	return NumBuckets > 1 ? NumBuckets * static_cast<int64>(sizeof(FSetElementId)) : 0;
+}
+
+FObjectSizeBreakdown FObjectProfilerCore::MeasureObjectSize(UObject* Obj)
+{
+	FResourceSizeEx ResourceSize(ResourceSizeMode);
+	Obj->GetResourceSizeEx(ResourceSize);
+	
+	FObjectSizeBreakdown Breakdown;
+	Breakdown.SystemBytes = ResourceSize.GetDedicatedSystemMemoryBytes();
+	Breakdown.VideoBytes = ResourceSize.GetDedicatedVideoMemoryBytes();
+	Breakdown.UnknownBytes = ResourceSize.GetUnknownMemoryBytes();
+	return Breakdown;
+}
+
+void FObjectProfilerCore::TrackLargestObject(FLargestObjectsList& LargestObjects, const UObject* Obj, int64 Size, int32 Sign, FWorldResolveCache& WorldCache)
+{
+	if (Sign > 0 && LargestObjects.WouldKeep(Size))
+	{
+		FLargestObjectEntry Entry;
+		Entry.ObjectPath = Obj->GetPathName();
+		Entry.ClassName = Obj->GetClass()->GetName();
+		Entry.OuterName = Obj->GetOuter() ? Obj->GetOuter()->GetName() : FString();
+		Entry.WorldLabel = ResolveWorldLabel(Obj, WorldCache);
+		Entry.SizeBytes = Size;
+		LargestObjects.Offer(MoveTemp(Entry));
+	}
+	else if (Sign < 0 && LargestObjects.MayContain(Size))
+	{
+		LargestObjects.Remove(Obj->GetPathName());
+	}
+}
+
+void FObjectProfilerCore::SetCollectionConsistency(ECollectionConsistency Consistency)
+{
+	CollectionConsistency = Consistency;
+}
+
+ECollectionConsistency FObjectProfilerCore::GetCollectionConsistency()
+{
+	return CollectionConsistency;
+}
+
+void FObjectProfilerCore::SetCollectionSizing(ECollectionSizing Sizing)
+{
+	CollectionSizing = Sizing;
+}
+
+ECollectionSizing FObjectProfilerCore::GetCollectionSizing()
+{
+	return CollectionSizing;
+}
+
+void FObjectProfilerCore::SetResourceSizeMode(EResourceSizeMode::Type Mode)
+{
+	ResourceSizeMode = Mode;
+}
+
+EResourceSizeMode::Type FObjectProfilerCore::GetResourceSizeMode()
+{
+	return ResourceSizeMode;
+}
+
+void FObjectProfilerCore::StartCollectionJournal()
+{
+	{
+		FScopeLock Lock(&JournalLock);
+		JournalEntries.Reset();
+		JournalOpenEntries.Reset();
+		JournalCountedIndices.Init(false, GUObjectArray.GetObjectArrayNum());
+	}
+	
+	JournalCreateListener = new FJournalCreateListener();
+	JournalDeleteListener = new FJournalDeleteListener();
+	
+	GUObjectArray.AddUObjectCreateListener(JournalCreateListener);
+	GUObjectArray.AddUObjectDeleteListener(JournalDeleteListener);
+}
+
+void FObjectProfilerCore::StopCollectionJournal()
+{
+	if (JournalCreateListener)
+	{
+		GUObjectArray.RemoveUObjectCreateListener(JournalCreateListener);
+		delete JournalCreateListener;
+		JournalCreateListener = nullptr;
+	}
+	
+	if (JournalDeleteListener)
+	{
+		GUObjectArray.RemoveUObjectDeleteListener(JournalDeleteListener);
+		delete JournalDeleteListener;
+		JournalDeleteListener = nullptr;
+	}
+	
+	FScopeLock Lock(&JournalLock);
+	JournalEntries.Empty();
+	JournalOpenEntries.Empty();
+	JournalCountedIndices.Empty();
+}
+
+void FObjectProfilerCore::ReconcileCollectionJournal()
+{
+	const bool bTargetStart = CollectionConsistency == ECollectionConsistency::CollectionStart;
+	
+	TMap<UClass*, int64> AverageSizes;
+	for (const auto& Pair : AsyncState.StatsMap)
+	{
+		if (Pair.Value->InstanceCount > 0 && Pair.Value->bSizeAvailable)
+		{
+			AverageSizes.Add(Pair.Key, Pair.Value->TotalSizeBytes / Pair.Value->InstanceCount);
+		}
+	}
+	
+	TMap<const UPackage*, bool> ScopePackageMatches;
+	
+	FScopeLock Lock(&JournalLock);
+	
+	for (const TPair<int32, int32>& Open : JournalOpenEntries)
+	{
+		JournalEntries[Open.Value].bCounted = JournalCountedIndices.IsValidIndex(Open.Key) && JournalCountedIndices[Open.Key];
+	}
+	
+	int32 Adjusted = 0;
+	for (const FJournalEntry& Entry : JournalEntries)
+	{
+		if (AsyncState.bScoped && Entry.bDeleted && !Entry.bCounted)
+		{
+			continue;
+		}
+		
+		const int32 Target = bTargetStart ? (Entry.bExistedAtStart ? 1 : 0) : (Entry.bDeleted ? 0 : 1);
+		const int32 Adjustment = Target - (Entry.bCounted ? 1 : 0);
+		if (Adjustment == 0)
+		{
+			continue;
+		}
+		
+		if (!Entry.bDeleted)
+		{
+			FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(Entry.ObjectIndex);
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 6
+			UObject* Obj = ObjectItem ? static_cast<UObject*>(ObjectItem->GetObject()) : nullptr;
+#else
+			UObject* Obj = ObjectItem ? static_cast<UObject*>(ObjectItem->Object) : nullptr;
+#endif
+			if (AsyncState.bScoped && !MatchesScope(Obj, AsyncState.Scope, ScopePackageMatches, AsyncState.WorldCache.OuterToWorld))
+			{
+				continue;
+			}
+			
+			if (IsValid(Obj) && Obj->GetClass())
+			{
+				AccumulateObject(FindOrAddClassStats(AsyncState.StatsMap, Obj->GetClass()), Obj, AsyncState.WorldCache, Adjustment, AsyncState.MaxSamplesPerClass, true, &AsyncState.LargestObjects);
+				Adjusted++;
+			}
+			continue;
+		}
+		
+		if (UClass* EntryClass = Entry.Class.Get())
+		{
+			FObjectClassStats& Stats = FindOrAddClassStats(AsyncState.StatsMap, EntryClass);
+			Stats.InstanceCount += Adjustment;
+			Stats.TotalSizeBytes += AverageSizes.FindRef(EntryClass) * Adjustment;
+			Adjusted++;
+		}
+	}
+	
+	for (auto It = AsyncState.StatsMap.CreateIterator(); It; ++It)
+	{
+		if (It.Value()->InstanceCount <= 0)
+		{
+			It.RemoveCurrent();
+		}
+		else
+		{
+			It.Value()->TotalSizeBytes = FMath::Max<int64>(0, It.Value()->TotalSizeBytes);
+		}
+	}
+	
+	UE_LOG(LogTemp, Verbose, TEXT("ObjectProfiler: Reconciled %d of %d journaled objects to collection %s"),
+		Adjusted, JournalEntries.Num(), bTargetStart ? TEXT("start") : TEXT("end"));
+}
+
+void FObjectProfilerCore::FinalizeCollection()
+{
+	ReconcileCollectionJournal();
+	StopCollectionJournal();
+	
+	TArray<TSharedPtr<FObjectClassStats>> Result;
+	AsyncState.StatsMap.GenerateValueArray(Result);
+	LatestLargestObjects = AsyncState.LargestObjects.GetSorted();
+	if (const TSharedPtr<FObjectProfilerSession> Session = AsyncState.Session.Pin())
+	{
+		Session->ApplyHistory(Result, true, AsyncState.Scope);
+	}
+	ComputeHierarchyRollups(Result);
+	
+	if (!AsyncState.bScoped)
+	{
+		FObjectProfilerMemoryReconciliation::RecordSample(Result);
+	}
+
+	TArray<FOnObjectStatsCollected> Consumers = MoveTemp(AsyncState.Consumers);
+	
+	AsyncState.Reset();
+	RefreshGarbageCollectBinding();
+
+	for (const FOnObjectStatsCollected& Consumer : Consumers)
+	{
+		Consumer.ExecuteIfBound(Result);
+	}
+	
+	StartNextQueuedCollection();
+}
+
+TArray<FString> FObjectProfilerCore::GetInstancesOfClass(const UClass* InClass)
+{
+	if (!InClass)
+	{
+		return TArray<FString>();
+	}
+
+	FHeapWalkRequest Request;
+	Request.Needs = EHeapWalkNeeds::Instances;
+	Request.InstanceClasses.Add(InClass);
+	
+	const FHeapWalkResult Result = WalkHeap(Request);
+	return Result.bCancelled ? TArray<FString>() : Result.InstancesByClass.FindRef(InClass);
+}
+
+TArray<FString> FObjectProfilerCore::GetInstancesOfClass(const FString& ClassName)
+{
+	const FName ClassFName(*ClassName);
+	
+	FHeapWalkRequest Request;
+	Request.Needs = EHeapWalkNeeds::Instances;
+	Request.InstanceClassNames.Add(ClassFName);
+	
+	const FHeapWalkResult Result = WalkHeap(Request);
+	return Result.bCancelled ? TArray<FString>() : Result.InstancesByClassName.FindRef(ClassFName);
+}
+
+FString FObjectProfilerCore::FormatInstanceEntry(const UObject* Obj)
+{
+	return FString::Printf(TEXT("%s | Outer: %s | Flags: 0x%08X"),
+		*Obj->GetPathName(),
+		Obj->GetOuter() ? *Obj->GetOuter()->GetName() : TEXT("None"),
+		static_cast<uint32>(Obj->GetFlags()));
+}
+
+FHeapWalkResult FObjectProfilerCore::WalkHeap(const FHeapWalkRequest& Request)
+{
+	TArray<FPendingHeapWalk> Coalesced = MoveTemp(PendingHeapWalks);
+	PendingHeapWalks.Reset();
+	
+	if (HeapWalkTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(HeapWalkTickerHandle);
+		HeapWalkTickerHandle.Reset();
+	}
+	
+	FHeapWalkRequest Merged = Request;
+	for (const FPendingHeapWalk& Pending : Coalesced)
+	{
+		Merged.Merge(Pending.Request);
+	}
+	
+	FHeapWalkResult Result;
+	if (Merged.Needs != EHeapWalkNeeds::None)
+	{
+		ExecuteHeapWalk(Merged, Result);
+	}
+	Result.NumConsumers = Coalesced.Num() + (Request.Needs != EHeapWalkNeeds::None ? 1 : 0);
+	
+	UE_LOG(LogTemp, Verbose, TEXT("ObjectProfiler: Heap walk over %d objects served %d consumers"), Result.TotalObjects, Result.NumConsumers);
+	
+	for (const FPendingHeapWalk& Pending : Coalesced)
+	{
+		Pending.OnComplete.ExecuteIfBound(Result);
+	}
+	
+	return Result;
+}
+
+void FObjectProfilerCore::RequestHeapWalk(const FHeapWalkRequest& Request, FOnHeapWalkComplete OnComplete)
+{
+	FPendingHeapWalk& Pending = PendingHeapWalks.AddDefaulted_GetRef();
+	Pending.Request = Request;
+	Pending.OnComplete = OnComplete;
+	
+	if (!HeapWalkTickerHandle.IsValid())
 	{
-		AsyncState.Phase = EAsyncPhase::Processing;
+		HeapWalkTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateStatic(&FObjectProfilerCore::OnHeapWalkTick),
+			0.0f
+		);
 	}
 }
 
-void FObjectProfilerCore::TickProcessing()
+bool FObjectProfilerCore::HasPendingHeapWalks()
 {
-	const int32 TotalObjects = AsyncState.ObjectsToProcess.Num();
-	const int32 EndIndex = FMath::Min(AsyncState.ProcessingIndex + ProcessingChunkSize, TotalObjects);
+	return PendingHeapWalks.Num() > 0;
+}
 
-	for (int32 i = AsyncState.ProcessingIndex; i < EndIndex; ++i)
+bool FObjectProfilerCore::OnHeapWalkTick(float DeltaTime)
+{
+	HeapWalkTickerHandle.Reset();
+	WalkHeap(FHeapWalkRequest());
+	return false;
+}
+
+void FObjectProfilerCore::ExecuteHeapWalk(const FHeapWalkRequest& Request, FHeapWalkResult& Result)
+{
+	FScopedProfilerCost Cost(EProfilerCostBucket::AsyncCollection);
+	
+	const bool bCounts = EnumHasAnyFlags(Request.Needs, EHeapWalkNeeds::Counts);
+	const bool bSizes = EnumHasAnyFlags(Request.Needs, EHeapWalkNeeds::Sizes | EHeapWalkNeeds::CategoryBreakdown | EHeapWalkNeeds::ModuleBreakdown | EHeapWalkNeeds::ActorFootprint);
+	const bool bCategories = EnumHasAnyFlags(Request.Needs, EHeapWalkNeeds::CategoryBreakdown);
+	const bool bModules = EnumHasAnyFlags(Request.Needs, EHeapWalkNeeds::ModuleBreakdown);
+	const bool bInstances = EnumHasAnyFlags(Request.Needs, EHeapWalkNeeds::Instances);
+	const bool bFootprints = EnumHasAnyFlags(Request.Needs, EHeapWalkNeeds::ActorFootprint);
+	const int32 MaxSamples = EnumHasAnyFlags(Request.Needs, EHeapWalkNeeds::Samples) ? Request.MaxSamplesPerClass : 0;
+	
+	FWorldResolveCache WorldCache;
+	TMap<const UClass*, EObjectCategory> ClassCategories;
+	TMap<const UClass*, FString> ClassModules;
+	TMap<const UObject*, AActor*> OuterToActor;
+	TMap<AActor*, FActorFootprintTally> FootprintTallies;
+	
+	TOptional<FScopedSlowTask> SlowTask;
+	if (Request.bShowProgress)
 	{
-		UObject* Obj = AsyncState.ObjectsToProcess[i].Get();
+		SlowTask.Emplace(GUObjectArray.GetObjectArrayNumMinusAvailable(), FText::FromString(TEXT("Collecting object statistics...")));
+		SlowTask->MakeDialog(true);
+	}
+
+	for (TObjectIterator<UObject> It; It; ++It)
+	{
+		if (SlowTask.IsSet())
+		{
+			if (SlowTask->ShouldCancel())
+			{
+				Result.bCancelled = true;
+				break;
+			}
+			SlowTask->EnterProgressFrame(1);
+		}
+
+		UObject* Obj = *It;
 		if (!IsValid(Obj))
 		{
+			if (bCounts)
+			{
+				RecordGarbageObject(Result.ClassStats, Obj);
+			}
 			continue;
 		}
-
+		
 		UClass* ObjClass = Obj->GetClass();
-		if (!ObjClass)
+		
+		if (bInstances)
+		{
+			if (Request.InstanceClasses.Contains(ObjClass))
+			{
+				Result.InstancesByClass.FindOrAdd(ObjClass).Add(FormatInstanceEntry(Obj));
+			}
+			if (Request.InstanceClassNames.Contains(ObjClass->GetFName()))
+			{
+				Result.InstancesByClassName.FindOrAdd(ObjClass->GetFName()).Add(FormatInstanceEntry(Obj));
+			}
+		}
+
+		if (Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
 		{
 			continue;
 		}
+		
+		Result.TotalObjects++;
+		
+		const bool bMeasurable = bSizes && IsSafeForResourceSizeQuery(Obj);
+		const FObjectSizeBreakdown Breakdown = bMeasurable ? MeasureObjectSize(Obj) : FObjectSizeBreakdown();
+		const int64 Size = Breakdown.GetTotal();
+		Result.TotalSize += Size;
 
-		TSharedPtr<FObjectClassStats>& StatsPtr = AsyncState.StatsMap.FindOrAdd(ObjClass);
+		if (bCounts)
+		{
+			FObjectClassStats& Stats = FindOrAddClassStats(Result.ClassStats, ObjClass);
+			AccumulateObject(Stats, Obj, WorldCache, 1, MaxSamples, false);
+			
+			if (bMeasurable)
+			{
+				RecordObjectSize(Stats, Obj, Breakdown, 1, WorldCache, &Result.LargestObjects);
+			}
+		}
+		else if (bMeasurable)
+		{
+			TrackLargestObject(Result.LargestObjects, Obj, Size, 1, WorldCache);
+		}
 		
-		if (!StatsPtr.IsValid())
+		if (bMeasurable && bCategories)
 		{
-			StatsPtr = MakeShared<FObjectClassStats>();
-			StatsPtr->ClassName = ObjClass->GetName();
-			StatsPtr->ClassFName = ObjClass->GetFName();
-			StatsPtr->ClassPtr = ObjClass;
-			StatsPtr->Category = CategorizeClass(ObjClass);
-			StatsPtr->Source = GetObjectSource(ObjClass);
-			StatsPtr->ModuleName = GetModuleName(ObjClass);
-			StatsPtr->bSizeAvailable = false;
+			const EObjectCategory* Category = ClassCategories.Find(ObjClass);
+			if (!Category)
+			{
+				Category = &ClassCategories.Add(ObjClass, CategorizeClass(ObjClass));
+			}
+			Result.CategorySizes.FindOrAdd(*Category) += Size;
 		}
 		
-		FObjectClassStats& Stats = *StatsPtr;
-		Stats.InstanceCount++;
-
-		if (IsSafeForResourceSizeQuery(Obj))
+		if (bMeasurable && bModules)
 		{
-			Stats.TotalSizeBytes += Obj->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
-			Stats.bSizeAvailable = true;
+			const FString* ModuleName = ClassModules.Find(ObjClass);
+			if (!ModuleName)
+			{
+				ModuleName = &ClassModules.Add(ObjClass, GetModuleName(ObjClass));
+			}
+			Result.ModuleSizes.FindOrAdd(*ModuleName) += Size;
 		}
-
-		if (Stats.SampleObjectNames.Num() < AsyncState.MaxSamplesPerClass)
+		
+		if (bFootprints)
 		{
-			Stats.SampleObjectNames.Add(Obj->GetPathName());
+			if (AActor* OwningActor = ResolveOwningActor(Obj, OuterToActor))
+			{
+				FActorFootprintTally& Tally = FootprintTallies.FindOrAdd(OwningActor);
+				Tally.ChargedObjectCount++;
+				Tally.TotalSizeBytes += Size;
+				if (OwningActor == Obj)
+				{
+					Tally.OwnSizeBytes = Size;
+				}
+			}
 		}
 	}
-
-	AsyncState.ProcessingIndex = EndIndex;
-
-	if (AsyncState.OnProgress.IsBound() && TotalObjects > 0)
+	
+	if (bSizes && !Result.bCancelled)
 	{
-		constexpr float EnumerationWeight = 0.2f;
-		constexpr float ProcessingWeight = 0.8f;
-		const float Progress = EnumerationWeight + ProcessingWeight * 
-			(static_cast<float>(AsyncState.ProcessingIndex) / static_cast<float>(TotalObjects));
-		AsyncState.OnProgress.Execute(FMath::Clamp(Progress, 0.0f, 1.0f));
+		LatestLargestObjects = Result.LargestObjects.GetSorted();
 	}
-
-	if (AsyncState.ProcessingIndex >= TotalObjects)
+	
+	if (bFootprints && !Result.bCancelled)
 	{
-		AsyncState.Phase = EAsyncPhase::Complete;
+		RollupActorFootprints(FootprintTallies, Result.ActorFootprints);
 	}
 }
 
-void FObjectProfilerCore::FinalizeCollection()
+AActor* FObjectProfilerCore::ResolveOwningActor(UObject* Object, TMap<const UObject*, AActor*>& OuterToActor)
 {
-	const double CurrentTime = FPlatformTime::Seconds();
-	TArray<TSharedPtr<FObjectClassStats>> Result;
-	AsyncState.StatsMap.GenerateValueArray(Result);
-
-	for (auto& Stats : Result)
+	if (AActor* ObjectAsActor = Cast<AActor>(Object))
+	{
+		return ObjectAsActor;
+	}
+	
+	TArray<const UObject*, TInlineAllocator<16>> VisitedOuters;
+	AActor* FoundActor = nullptr;
+	
+	for (UObject* Outer = Object->GetOuter(); Outer; Outer = Outer->GetOuter())
 	{
-		if (Stats->InstanceCount > 0 && Stats->bSizeAvailable && Stats->TotalSizeBytes > 0)
+		if (AActor** CachedActor = OuterToActor.Find(Outer))
 		{
-			Stats->AverageSizeBytes = Stats->TotalSizeBytes / Stats->InstanceCount;
+			FoundActor = *CachedActor;
+			break;
 		}
 		
-		if (const TSharedPtr<FObjectClassStats>* PrevStats = PreviousStats.Find(Stats->ClassName))
+		VisitedOuters.Add(Outer);
+		
+		if (AActor* OuterActor = Cast<AActor>(Outer))
 		{
-			Stats->DeltaCount = Stats->InstanceCount - (*PrevStats)->InstanceCount;
-			Stats->DeltaSizeBytes = Stats->TotalSizeBytes - (*PrevStats)->TotalSizeBytes;
-			
-			Stats->History = (*PrevStats)->History;
-			Stats->AddHistoryPoint(Stats->InstanceCount, Stats->TotalSizeBytes, CurrentTime);
-			Stats->UpdateLeakDetection(LeakDetectionThreshold);
-			Stats->CalculateRateOfChange();
+			FoundActor = OuterActor;
+			break;
 		}
-		else
+		
+		if (Outer->IsA<ULevel>() || Outer->IsA<UWorld>())
 		{
-			Stats->AddHistoryPoint(Stats->InstanceCount, Stats->TotalSizeBytes, CurrentTime);
+			break;
 		}
-		
-		PreviousStats.Add(Stats->ClassName, Stats);
 	}
-
-	FOnObjectStatsCollected CompletionCallback = AsyncState.OnComplete;
 	
-	AsyncState.Reset();
-
-	if (CompletionCallback.IsBound())
+	for (const UObject* Visited : VisitedOuters)
 	{
-		CompletionCallback.Execute(Result);
+		OuterToActor.Add(Visited, FoundActor);
 	}
+	
+	return FoundActor;
 }
 
-TArray<FString> FObjectProfilerCore::GetInstancesOfClass(const UClass* InClass)
+void FObjectProfilerCore::RollupActorFootprints(const TMap<AActor*, FActorFootprintTally>& Tallies, TArray<FActorFootprintEntry>& OutFootprints)
 {
-	TArray<FString> Result;
-
-	if (!InClass)
-	{
-		return Result;
-	}
-
-	for (TObjectIterator<UObject> It; It; ++It)
+	TMap<const UClass*, FActorFootprintEntry> FootprintsByClass;
+	
+	for (const TPair<AActor*, FActorFootprintTally>& Pair : Tallies)
 	{
-		UObject* Obj = *It;
-		if (IsValid(Obj) && Obj->GetClass() == InClass)
+		const AActor* Actor = Pair.Key;
+		if (Actor->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
 		{
-			FString Entry = FString::Printf(TEXT("%s | Outer: %s | Flags: 0x%08X"),
-				*Obj->GetPathName(),
-				Obj->GetOuter() ? *Obj->GetOuter()->GetName() : TEXT("None"),
-				static_cast<uint32>(Obj->GetFlags()));
-			Result.Add(Entry);
+			continue;
 		}
-	}
-
-	return Result;
-}
-
-TArray<FString> FObjectProfilerCore::GetInstancesOfClass(const FString& ClassName)
-{
-	TArray<FString> Result;
-
-	for (TObjectIterator<UObject> It; It; ++It)
-	{
-		UObject* Obj = *It;
-		if (IsValid(Obj) && Obj->GetClass()->GetName() == ClassName)
+		
+		const FActorFootprintTally& Tally = Pair.Value;
+		FActorFootprintEntry& Entry = FootprintsByClass.FindOrAdd(Actor->GetClass());
+		if (Entry.ClassName.IsEmpty())
+		{
+			Entry.ClassName = Actor->GetClass()->GetName();
+		}
+		
+		Entry.ActorCount++;
+		Entry.ChargedObjectCount += Tally.ChargedObjectCount;
+		Entry.OwnSizeBytes += Tally.OwnSizeBytes;
+		Entry.TotalSizeBytes += Tally.TotalSizeBytes;
+		
+		if (Tally.TotalSizeBytes >= Entry.MaxActorSizeBytes)
 		{
-			FString Entry = FString::Printf(TEXT("%s | Outer: %s | Flags: 0x%08X"),
-				*Obj->GetPathName(),
-				Obj->GetOuter() ? *Obj->GetOuter()->GetName() : TEXT("None"),
-				static_cast<uint32>(Obj->GetFlags()));
-			Result.Add(Entry);
+			Entry.MaxActorSizeBytes = Tally.TotalSizeBytes;
+			Entry.LargestActorPath = Actor->GetPathName();
 		}
 	}
+	
+	FootprintsByClass.GenerateValueArray(OutFootprints);
+	OutFootprints.Sort([](const FActorFootprintEntry& A, const FActorFootprintEntry& B)
+	{
+		return A.TotalSizeBytes > B.TotalSizeBytes;
+	});
+}
 
-	return Result;
+void FObjectProfilerCore::TakeSnapshot(const FString& SnapshotName, const FProfilerCollectionScope& Scope)
+{
+	GetDefaultSession()->TakeScopedSnapshot(SnapshotName, Scope);
 }
 
-void FObjectProfilerCore::TakeSnapshot(const FString& SnapshotName)
+void FObjectProfilerCore::RequestSnapshot(const FString& SnapshotName, const FProfilerCollectionScope& Scope)
 {
-	FObjectSnapshot Snapshot;
-	Snapshot.Name = SnapshotName.IsEmpty() 
-		? FString::Printf(TEXT("Snapshot_%d"), SnapshotHistory.Num() + 1) 
-		: SnapshotName;
-	Snapshot.Timestamp = FDateTime::Now();
+	GetDefaultSession()->RequestScopedSnapshot(SnapshotName, Scope);
+}
 
-	for (TObjectIterator<UObject> It; It; ++It)
+void FObjectProfilerCore::FillSnapshotFromWalk(FObjectSnapshot& Snapshot, const FHeapWalkResult& WalkResult, FName WorldLabel)
+{
+	for (const auto& Pair : WalkResult.ClassStats)
 	{
-		UObject* Obj = *It;
-		if (IsValid(Obj) && !Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+		const FObjectClassStats& Stats = *Pair.Value;
+		int32 Count = Stats.InstanceCount;
+		int64 Size = Stats.TotalSizeBytes;
+		
+		if (!WorldLabel.IsNone())
+		{
+			const FObjectWorldStats* WorldStats = Stats.WorldStats.Find(WorldLabel);
+			if (!WorldStats || WorldStats->InstanceCount <= 0)
+			{
+				continue;
+			}
+			Count = WorldStats->InstanceCount;
+			Size = WorldStats->TotalSizeBytes;
+		}
+		
+		Snapshot.ClassCounts.FindOrAdd(Stats.ClassName) += Count;
+		Snapshot.TotalObjects += Count;
+		
+		if (Stats.bSizeAvailable)
 		{
-			const FString ClassName = Obj->GetClass()->GetName();
-			Snapshot.ClassCounts.FindOrAdd(ClassName)++;
-			Snapshot.TotalObjects++;
+			Snapshot.ClassSizes.FindOrAdd(Stats.ClassName) += Size;
+			Snapshot.TotalSize += Size;
 			
-			if (IsSafeForResourceSizeQuery(Obj))
+			if (WorldLabel.IsNone())
 			{
-				const int64 Size = Obj->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
-				Snapshot.ClassSizes.FindOrAdd(ClassName) += Size;
-				Snapshot.TotalSize += Size;
+				Snapshot.VideoSize += Stats.SizeBreakdown.VideoBytes;
 			}
 		}
 	}
-
-	if (SnapshotHistory.Num() >= MaxSnapshotHistory)
+	
+	for (const FLargestObjectEntry& Entry : WalkResult.LargestObjects.GetSorted())
 	{
-		SnapshotHistory.RemoveAt(0);
+		if (WorldLabel.IsNone() || Entry.WorldLabel == WorldLabel)
+		{
+			Snapshot.LargestObjects.Add(Entry);
+		}
 	}
-	
-	SnapshotHistory.Add(Snapshot);
-	
-	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Snapshot '%s' taken with %d unique classes, %d total objects"), 
-		*Snapshot.Name, Snapshot.ClassCounts.Num(), Snapshot.TotalObjects);
-	
-	SnapshotTakenDelegate.Broadcast(Snapshot);
 }
 
-TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::GetDeltaSinceSnapshot(int32 SnapshotIndex)
+void FObjectProfilerCore::FillSnapshotFromScope(FObjectSnapshot& Snapshot, const FProfilerCollectionScope& Scope, bool bMeasureSizes)
 {
-	TArray<TSharedPtr<FObjectClassStats>> Result;
-	
-	if (SnapshotHistory.Num() == 0)
-	{
-		return Result;
-	}
+	TArray<UObject*> ScopedObjects;
+	GatherScopedObjects(Scope, ScopedObjects);
 	
-	const int32 ActualIndex = SnapshotIndex < 0 ? SnapshotHistory.Num() - 1 : SnapshotIndex;
-	if (ActualIndex < 0 || ActualIndex >= SnapshotHistory.Num())
-	{
-		return Result;
-	}
+	FWorldResolveCache WorldCache;
+	FLargestObjectsList LargestObjects;
 	
-	const FObjectSnapshot& Snapshot = SnapshotHistory[ActualIndex];
-	TMap<FString, int32> CurrentCounts;
-
-	for (TObjectIterator<UObject> It; It; ++It)
-	{
-		UObject* Obj = *It;
-		if (IsValid(Obj) && !Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
-		{
-			CurrentCounts.FindOrAdd(Obj->GetClass()->GetName())++;
-		}
-	}
-
-	for (const auto& [ClassName, CurrentCount] : CurrentCounts)
+	for (UObject* Obj : ScopedObjects)
 	{
-		const int32 SnapshotCount = Snapshot.ClassCounts.FindRef(ClassName);
-		const int32 Delta = CurrentCount - SnapshotCount;
-
-		if (Delta != 0)
+		const FString ClassName = Obj->GetClass()->GetName();
+		Snapshot.ClassCounts.FindOrAdd(ClassName)++;
+		Snapshot.TotalObjects++;
+		
+		if (bMeasureSizes && IsSafeForResourceSizeQuery(Obj))
 		{
-			TSharedPtr<FObjectClassStats> Stats = MakeShared<FObjectClassStats>();
-			Stats->ClassName = ClassName;
-			Stats->InstanceCount = Delta;
-			Stats->DeltaCount = Delta;
-			Result.Add(Stats);
+			const FObjectSizeBreakdown Breakdown = MeasureObjectSize(Obj);
+			const int64 Size = Breakdown.GetTotal();
+			Snapshot.ClassSizes.FindOrAdd(ClassName) += Size;
+			Snapshot.TotalSize += Size;
+			Snapshot.VideoSize += Breakdown.VideoBytes;
+			TrackLargestObject(LargestObjects, Obj, Size, 1, WorldCache);
 		}
 	}
 	
-	for (const auto& [ClassName, SnapshotCount] : Snapshot.ClassCounts)
-	{
-		if (!CurrentCounts.Contains(ClassName))
-		{
-			TSharedPtr<FObjectClassStats> Stats = MakeShared<FObjectClassStats>();
-			Stats->ClassName = ClassName;
-			Stats->InstanceCount = -SnapshotCount;
-			Stats->DeltaCount = -SnapshotCount;
-			Result.Add(Stats);
-		}
-	}
+	Snapshot.LargestObjects = LargestObjects.GetSorted();
+}
 
-	return Result;
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::GetDeltaSinceSnapshot(int32 SnapshotIndex)
+{
+	return GetDefaultSession()->GetDeltaSinceSnapshot(SnapshotIndex);
 }
 
 TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::CompareTwoSnapshots(int32 IndexA, int32 IndexB)
+{
+	return GetDefaultSession()->CompareTwoSnapshots(IndexA, IndexB);
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::DiffSnapshots(const FObjectSnapshot& SnapshotA, const FObjectSnapshot& SnapshotB, bool bIncludeSizes)
 {
 	TArray<TSharedPtr<FObjectClassStats>> Result;
 	
-	if (IndexA < 0 || IndexA >= SnapshotHistory.Num() || IndexB < 0 || IndexB >= SnapshotHistory.Num())
-	{
-		return Result;
-	}
-	
-	const FObjectSnapshot& SnapshotA = SnapshotHistory[IndexA];
-	const FObjectSnapshot& SnapshotB = SnapshotHistory[IndexB];
-	
 	TSet<FString> AllClasses;
 	for (const auto& [ClassName, Count] : SnapshotA.ClassCounts)
 	{
@@ -1009,137 +2393,49 @@ TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerCore::CompareTwoSnapshots(i
 			Stats->InstanceCount = Delta;
 			Stats->DeltaCount = Delta;
 			
-			const int64 SizeA = SnapshotA.ClassSizes.FindRef(ClassName);
-			const int64 SizeB = SnapshotB.ClassSizes.FindRef(ClassName);
-			Stats->DeltaSizeBytes = SizeB - SizeA;
+			if (bIncludeSizes)
+			{
+				const int64 SizeA = SnapshotA.ClassSizes.FindRef(ClassName);
+				const int64 SizeB = SnapshotB.ClassSizes.FindRef(ClassName);
+				Stats->DeltaSizeBytes = SizeB - SizeA;
+			}
 			
 			Result.Add(Stats);
 		}
 	}
 	
+	ComputeHierarchyRollups(Result);
 	return Result;
 }
 
 const TArray<FObjectSnapshot>& FObjectProfilerCore::GetSnapshotHistory()
 {
-	return SnapshotHistory;
+	return GetDefaultSession()->GetSnapshotHistory();
+}
+
+void FObjectProfilerCore::AddSnapshot(const FObjectSnapshot& Snapshot)
+{
+	GetDefaultSession()->AddSnapshot(Snapshot);
 }
 
 void FObjectProfilerCore::ClearSnapshotHistory()
 {
-	SnapshotHistory.Empty();
+	GetDefaultSession()->ClearSnapshotHistory();
 }
 
 void FObjectProfilerCore::DeleteSnapshot(int32 Index)
 {
-	if (Index >= 0 && Index < SnapshotHistory.Num())
-	{
-		SnapshotHistory.RemoveAt(Index);
-	}
+	GetDefaultSession()->DeleteSnapshot(Index);
 }
 
 bool FObjectProfilerCore::SaveSnapshotsToFile(const FString& FilePath)
 {
-	TSharedPtr<FJsonObject> RootObject = MakeShared<FJsonObject>();
-	TArray<TSharedPtr<FJsonValue>> SnapshotsArray;
-	
-	for (const FObjectSnapshot& Snapshot : SnapshotHistory)
-	{
-		TSharedPtr<FJsonObject> SnapshotObject = MakeShared<FJsonObject>();
-		SnapshotObject->SetStringField(TEXT("Name"), Snapshot.Name);
-		SnapshotObject->SetStringField(TEXT("Timestamp"), Snapshot.Timestamp.ToString());
-		SnapshotObject->SetNumberField(TEXT("TotalObjects"), Snapshot.TotalObjects);
-		SnapshotObject->SetNumberField(TEXT("TotalSize"), static_cast<double>(Snapshot.TotalSize));
-		
-		TSharedPtr<FJsonObject> ClassCountsObject = MakeShared<FJsonObject>();
-		for (const auto& [ClassName, Count] : Snapshot.ClassCounts)
-		{
-			ClassCountsObject->SetNumberField(ClassName, Count);
-		}
-		SnapshotObject->SetObjectField(TEXT("ClassCounts"), ClassCountsObject);
-		
-		TSharedPtr<FJsonObject> ClassSizesObject = MakeShared<FJsonObject>();
-		for (const auto& [ClassName, Size] : Snapshot.ClassSizes)
-		{
-			ClassSizesObject->SetNumberField(ClassName, static_cast<double>(Size));
-		}
-		SnapshotObject->SetObjectField(TEXT("ClassSizes"), ClassSizesObject);
-		
-		SnapshotsArray.Add(MakeShared<FJsonValueObject>(SnapshotObject));
-	}
-	
-	RootObject->SetArrayField(TEXT("Snapshots"), SnapshotsArray);
-	
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
-	
-	return FFileHelper::SaveStringToFile(OutputString, *FilePath);
+	return GetDefaultSession()->SaveSnapshotsToFile(FilePath);
 }
 
 bool FObjectProfilerCore::LoadSnapshotsFromFile(const FString& FilePath)
 {
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
-	{
-		return false;
-	}
-	
-	TSharedPtr<FJsonObject> RootObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
-	{
-		return false;
-	}
-	
-	const TArray<TSharedPtr<FJsonValue>>* SnapshotsArray;
-	if (!RootObject->TryGetArrayField(TEXT("Snapshots"), SnapshotsArray))
-	{
-		return false;
-	}
-	
-	for (const TSharedPtr<FJsonValue>& SnapshotValue : *SnapshotsArray)
-	{
-		const TSharedPtr<FJsonObject>* SnapshotObject;
-		if (!SnapshotValue->TryGetObject(SnapshotObject))
-		{
-			continue;
-		}
-		
-		FObjectSnapshot Snapshot;
-		Snapshot.Name = (*SnapshotObject)->GetStringField(TEXT("Name"));
-		
-		const FString TimestampStr = (*SnapshotObject)->GetStringField(TEXT("Timestamp"));
-		FDateTime::Parse(TimestampStr, Snapshot.Timestamp);
-		
-		Snapshot.TotalObjects = (*SnapshotObject)->GetIntegerField(TEXT("TotalObjects"));
-		Snapshot.TotalSize = static_cast<int64>((*SnapshotObject)->GetNumberField(TEXT("TotalSize")));
-		
-		const TSharedPtr<FJsonObject>* ClassCountsObject;
-		if ((*SnapshotObject)->TryGetObjectField(TEXT("ClassCounts"), ClassCountsObject))
-		{
-			for (const auto& [Key, Value] : (*ClassCountsObject)->Values)
-			{
-				Snapshot.ClassCounts.Add(Key, static_cast<int32>(Value->AsNumber()));
-			}
-		}
-		
-		const TSharedPtr<FJsonObject>* ClassSizesObject;
-		if ((*SnapshotObject)->TryGetObjectField(TEXT("ClassSizes"), ClassSizesObject))
-		{
-			for (const auto& [Key, Value] : (*ClassSizesObject)->Values)
-			{
-				Snapshot.ClassSizes.Add(Key, static_cast<int64>(Value->AsNumber()));
-			}
-		}
-		
-		if (SnapshotHistory.Num() < MaxSnapshotHistory)
-		{
-			SnapshotHistory.Add(Snapshot);
-		}
-	}
-	
-	return true;
+	return GetDefaultSession()->LoadSnapshotsFromFile(FilePath);
 }
 
 void FObjectProfilerCore::ForceGarbageCollection()
@@ -1191,106 +2487,51 @@ FString FObjectProfilerCore::FormatBytes(int64 Bytes)
 
 void FObjectProfilerCore::StartRealTimeMonitoring(float IntervalSeconds)
 {
-	if (bRealTimeMonitoringActive)
-	{
-		StopRealTimeMonitoring();
-	}
-	
-	StartIncrementalTracking();
-	
-	RealTimeIntervalSeconds = FMath::Max(0.1f, IntervalSeconds);
-	bRealTimeMonitoringActive = true;
-	LastRealTimeUpdateTime = FPlatformTime::Seconds();
-	
-	RealTimeTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
-		FTickerDelegate::CreateStatic(&FObjectProfilerCore::OnRealTimeTick),
-		RealTimeIntervalSeconds
-	);
-	
-	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Real-time monitoring started (interval: %.1fs, incremental: %s)"), 
-		RealTimeIntervalSeconds, bIncrementalTrackingActive ? TEXT("yes") : TEXT("no"));
+	GetDefaultSession()->StartRealTimeMonitoring(IntervalSeconds);
 }
 
 void FObjectProfilerCore::StopRealTimeMonitoring()
-{
-	if (RealTimeTickerHandle.IsValid())
-	{
-		FTSTicker::GetCoreTicker().RemoveTicker(RealTimeTickerHandle);
-		RealTimeTickerHandle.Reset();
-	}
-	
-	StopIncrementalTracking();
-	
-	bRealTimeMonitoringActive = false;
-	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Real-time monitoring stopped"));
+{
+	GetDefaultSession()->StopRealTimeMonitoring();
 }
 
 bool FObjectProfilerCore::IsRealTimeMonitoringActive()
 {
-	return bRealTimeMonitoringActive;
+	return GetDefaultSession()->IsRealTimeMonitoringActive();
 }
 
 void FObjectProfilerCore::SetRealTimeInterval(float IntervalSeconds)
 {
-	RealTimeIntervalSeconds = FMath::Max(0.1f, IntervalSeconds);
-	
-	if (bRealTimeMonitoringActive)
-	{
-		StopRealTimeMonitoring();
-		StartRealTimeMonitoring(RealTimeIntervalSeconds);
-	}
+	GetDefaultSession()->SetRealTimeInterval(IntervalSeconds);
 }
 
 float FObjectProfilerCore::GetRealTimeInterval()
 {
-	return RealTimeIntervalSeconds;
+	return GetDefaultSession()->GetRealTimeInterval();
 }
 
 FOnRealTimeUpdate& FObjectProfilerCore::OnRealTimeUpdate()
 {
-	return RealTimeUpdateDelegate;
+	return GetDefaultSession()->OnRealTimeUpdate();
 }
 
 FOnSnapshotTaken& FObjectProfilerCore::OnSnapshotTaken()
 {
-	return SnapshotTakenDelegate;
-}
-
-bool FObjectProfilerCore::OnRealTimeTick(float DeltaTime)
-{
-	if (!bRealTimeMonitoringActive)
-	{
-		return false;
-	}
-	
-	UpdateRealTimeStats();
-	return true;
+	return GetDefaultSession()->OnSnapshotTaken();
 }
 
-void FObjectProfilerCore::UpdateRealTimeStats()
+TSharedRef<FObjectProfilerSession> FObjectProfilerCore::GetDefaultSession()
 {
-	if (bIncrementalTrackingActive)
-	{
-		TArray<TSharedPtr<FObjectClassStats>> Results = GetIncrementalStats();
-		LastRealTimeUpdateTime = FPlatformTime::Seconds();
-		RealTimeUpdateDelegate.Broadcast(Results);
-		return;
-	}
-	
-	if (!IsAsyncCollectionInProgress())
+	if (!DefaultSession.IsValid())
 	{
-		CollectObjectStatsAsync(
-			3,
-			FOnObjectStatsCollected::CreateStatic(&FObjectProfilerCore::OnRealTimeCollectionComplete),
-			FOnCollectionProgress()
-		);
+		DefaultSession = MakeShared<FObjectProfilerSession>(TEXT("Default"));
 	}
+	return DefaultSession.ToSharedRef();
 }
 
-void FObjectProfilerCore::OnRealTimeCollectionComplete(TArray<TSharedPtr<FObjectClassStats>> Results)
+void FObjectProfilerCore::ResetDefaultSession()
 {
-	LastRealTimeUpdateTime = FPlatformTime::Seconds();
-	RealTimeUpdateDelegate.Broadcast(Results);
+	DefaultSession.Reset();
 }
 
 TArray<FReferenceInfo> FObjectProfilerCore::GetReferencesTo(const UObject* Object)
@@ -1400,56 +2641,66 @@ TArray<FReferenceInfo> FObjectProfilerCore::GetReferenceChain(const UObject* Obj
 
 TMap<EObjectCategory, int64> FObjectProfilerCore::GetMemoryBreakdownByCategory()
 {
-	TMap<EObjectCategory, int64> Result;
-
-	for (TObjectIterator<UObject> It; It; ++It)
-	{
-		UObject* Obj = *It;
-		if (!IsValid(Obj) || Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
-		{
-			continue;
-		}
-
-		if (IsSafeForResourceSizeQuery(Obj))
-		{
-			const EObjectCategory Category = CategorizeClass(Obj->GetClass());
-			Result.FindOrAdd(Category) += Obj->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
-		}
-	}
-
-	return Result;
+	FHeapWalkRequest Request;
+	Request.Needs = EHeapWalkNeeds::CategoryBreakdown;
+	FHeapWalkResult Result = WalkHeap(Request);
+	return Result.bCancelled ? TMap<EObjectCategory, int64>() : MoveTemp(Result.CategorySizes);
 }
 
 TMap<FString, int64> FObjectProfilerCore::GetMemoryBreakdownByModule()
 {
-	TMap<FString, int64> Result;
+	FHeapWalkRequest Request;
+	Request.Needs = EHeapWalkNeeds::ModuleBreakdown;
+	FHeapWalkResult Result = WalkHeap(Request);
+	return Result.bCancelled ? TMap<FString, int64>() : MoveTemp(Result.ModuleSizes);
+}
+
+const TArray<FLargestObjectEntry>& FObjectProfilerCore::GetLargestObjects()
+{
+	return LatestLargestObjects;
+}
 
-	for (TObjectIterator<UObject> It; It; ++It)
+bool FObjectProfilerCore::FocusObjectInEditor(const FString& ObjectPath)
+{
+	UObject* Obj = FindObject<UObject>(nullptr, *ObjectPath);
+	if (!Obj)
 	{
-		UObject* Obj = *It;
-		if (!IsValid(Obj) || Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
-		{
-			continue;
-		}
-
-		if (IsSafeForResourceSizeQuery(Obj))
-		{
-			const FString ModuleName = GetModuleName(Obj->GetClass());
-			Result.FindOrAdd(ModuleName) += Obj->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
-		}
+		return false;
 	}
-
-	return Result;
+	
+	AActor* Actor = Cast<AActor>(Obj);
+	if (!Actor)
+	{
+		Actor = Obj->GetTypedOuter<AActor>();
+	}
+	
+	if (Actor && GEditor)
+	{
+		GEditor->SelectNone(false, true);
+		GEditor->SelectActor(Actor, true, true);
+		GEditor->MoveViewportCamerasToActor(*Actor, false);
+		return true;
+	}
+	
+	UObject* Asset = Obj->IsAsset() ? Obj : Obj->GetOutermostObject();
+	if (Asset && Asset->IsAsset())
+	{
+		FContentBrowserModule& ContentBrowserModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+		TArray<FAssetData> AssetDatas;
+		AssetDatas.Add(FAssetData(Asset));
+		ContentBrowserModule.Get().SyncBrowserToAssets(AssetDatas);
+	}
+	return true;
 }
 
 void FObjectProfilerCore::SetLeakDetectionThreshold(int32 ConsecutiveTicks)
 {
-	LeakDetectionThreshold = FMath::Max(2, ConsecutiveTicks);
+	GetDefaultSession()->SetLeakDetectionThreshold(ConsecutiveTicks);
 }
 
 int32 FObjectProfilerCore::GetLeakDetectionThreshold()
 {
-	return LeakDetectionThreshold;
+	return GetDefaultSession()->GetLeakDetectionThreshold();
 }
 
 TArray<TSharedPtr<FProfilerTreeItem>> FObjectProfilerCore::BuildTreeView(
@@ -1471,65 +2722,445 @@ TArray<TSharedPtr<FProfilerTreeItem>> FObjectProfilerCore::BuildTreeView(
 		return Result;
 	}
 	
+	if (GroupMode == EProfilerGroupMode::ByWorld)
+	{
+		return BuildOwnerTreeView(Stats, &FObjectClassStats::WorldStats, FProfilerTreeItem::EItemType::World);
+	}
+	
+	if (GroupMode == EProfilerGroupMode::ByPackage)
+	{
+		return BuildOwnerTreeView(Stats, &FObjectClassStats::PackageStats, FProfilerTreeItem::EItemType::Package);
+	}
+	
+	if (GroupMode == EProfilerGroupMode::ByOuter)
+	{
+		return BuildOwnerTreeView(Stats, &FObjectClassStats::OuterStats, FProfilerTreeItem::EItemType::Outer);
+	}
+	
+	if (GroupMode == EProfilerGroupMode::ByClassHierarchy)
+	{
+		return BuildHierarchyTreeView(Stats);
+	}
+	
+	return BuildNestedTreeView(Stats, {GroupMode});
+}
+
+TArray<TSharedPtr<FProfilerTreeItem>> FObjectProfilerCore::BuildTreeView(
+	const TArray<TSharedPtr<FObjectClassStats>>& Stats,
+	const TArray<EProfilerGroupMode>& GroupLevels)
+{
+	if (GroupLevels.Num() == 1)
+	{
+		return BuildTreeView(Stats, GroupLevels[0]);
+	}
+	
+	return BuildNestedTreeView(Stats, GroupLevels);
+}
+
+bool FObjectProfilerCore::GetGroupKey(const FObjectClassStats& Stats, EProfilerGroupMode GroupLevel, FString& OutGroupName, FProfilerTreeItem::EItemType& OutGroupType)
+{
+	switch (GroupLevel)
+	{
+	case EProfilerGroupMode::BySource:
+		OutGroupName = GetSourceDisplayName(Stats.Source);
+		OutGroupType = FProfilerTreeItem::EItemType::Source;
+		return true;
+	case EProfilerGroupMode::ByModule:
+		OutGroupName = Stats.ModuleName;
+		OutGroupType = FProfilerTreeItem::EItemType::Module;
+		return true;
+	case EProfilerGroupMode::ByCategory:
+		OutGroupName = GetCategoryDisplayName(Stats.Category);
+		OutGroupType = FProfilerTreeItem::EItemType::Category;
+		return true;
+	default:
+		return false;
+	}
+}
+
+TArray<TSharedPtr<FProfilerTreeItem>> FObjectProfilerCore::BuildNestedTreeView(const TArray<TSharedPtr<FObjectClassStats>>& Stats, const TArray<EProfilerGroupMode>& GroupLevels)
+{
+	TArray<TSharedPtr<FProfilerTreeItem>> Result;
 	TMap<FString, TSharedPtr<FProfilerTreeItem>> GroupMap;
 	
 	for (const auto& StatItem : Stats)
 	{
-		FString GroupName;
-		FProfilerTreeItem::EItemType GroupType;
+		TSharedPtr<FProfilerTreeItem> ParentItem;
+		FString GroupPath;
+		
+		for (EProfilerGroupMode GroupLevel : GroupLevels)
+		{
+			FString GroupName;
+			FProfilerTreeItem::EItemType GroupType;
+			if (!GetGroupKey(*StatItem, GroupLevel, GroupName, GroupType))
+			{
+				continue;
+			}
+			
+			GroupPath += TEXT("\n");
+			GroupPath += GroupName;
+			
+			TSharedPtr<FProfilerTreeItem>& GroupItem = GroupMap.FindOrAdd(GroupPath);
+			if (!GroupItem.IsValid())
+			{
+				GroupItem = MakeShared<FProfilerTreeItem>();
+				GroupItem->Type = GroupType;
+				GroupItem->DisplayName = GroupName;
+				GroupItem->Parent = ParentItem;
+				
+				if (ParentItem.IsValid())
+				{
+					ParentItem->Children.Add(GroupItem);
+				}
+				else
+				{
+					Result.Add(GroupItem);
+				}
+			}
+			ParentItem = GroupItem;
+		}
+		
+		TSharedPtr<FProfilerTreeItem> ClassItem = MakeShared<FProfilerTreeItem>();
+		ClassItem->Type = FProfilerTreeItem::EItemType::Class;
+		ClassItem->DisplayName = StatItem->ClassName;
+		ClassItem->Stats = StatItem;
+		ClassItem->Parent = ParentItem;
 		
-		if (GroupMode == EProfilerGroupMode::ByModule)
+		if (ParentItem.IsValid())
 		{
-			GroupName = StatItem->ModuleName;
-			GroupType = FProfilerTreeItem::EItemType::Module;
+			ParentItem->Children.Add(ClassItem);
 		}
 		else
 		{
-			static const TMap<EObjectCategory, FString> CategoryNames = {
-				{EObjectCategory::Unknown, TEXT("Unknown")},
-				{EObjectCategory::Actor, TEXT("Actors")},
-				{EObjectCategory::Component, TEXT("Components")},
-				{EObjectCategory::Asset, TEXT("Assets")},
-				{EObjectCategory::Widget, TEXT("Widgets")},
-				{EObjectCategory::Animation, TEXT("Animation")},
-				{EObjectCategory::Audio, TEXT("Audio")},
-				{EObjectCategory::Material, TEXT("Materials")},
-				{EObjectCategory::Texture, TEXT("Textures")},
-				{EObjectCategory::Mesh, TEXT("Meshes")},
-				{EObjectCategory::Blueprint, TEXT("Blueprints")},
-				{EObjectCategory::DataAsset, TEXT("Data Assets")},
-				{EObjectCategory::Subsystem, TEXT("Subsystems")},
-				{EObjectCategory::GameInstance, TEXT("Game Instance")},
-				{EObjectCategory::Other, TEXT("Other")}
-			};
-			
-			GroupName = CategoryNames.FindRef(StatItem->Category);
-			GroupType = FProfilerTreeItem::EItemType::Category;
+			Result.Add(ClassItem);
 		}
-		
-		TSharedPtr<FProfilerTreeItem>& GroupItem = GroupMap.FindOrAdd(GroupName);
+	}
+	
+	for (const TSharedPtr<FProfilerTreeItem>& RootItem : Result)
+	{
+		RootItem->CacheAggregates();
+	}
+	SortGroupsByCount(Result);
+	
+	return Result;
+}
+
+void FObjectProfilerCore::SortGroupsByCount(TArray<TSharedPtr<FProfilerTreeItem>>& Items)
+{
+	if (Items.Num() == 0 || Items[0]->Type == FProfilerTreeItem::EItemType::Class)
+	{
+		return;
+	}
+	
+	Items.Sort([](const TSharedPtr<FProfilerTreeItem>& A, const TSharedPtr<FProfilerTreeItem>& B)
+	{
+		return A->GetAggregatedInstanceCount() > B->GetAggregatedInstanceCount();
+	});
+	
+	for (const TSharedPtr<FProfilerTreeItem>& Item : Items)
+	{
+		SortGroupsByCount(Item->Children);
+	}
+}
+
+TSharedPtr<FObjectClassStats> FObjectProfilerCore::MakeOwnerRowStats(const FObjectClassStats& ClassStats, const FObjectWorldStats& OwnerValue)
+{
+	TSharedPtr<FObjectClassStats> OwnerStat = MakeShared<FObjectClassStats>();
+	OwnerStat->ClassName = ClassStats.ClassName;
+	OwnerStat->ClassFName = ClassStats.ClassFName;
+	OwnerStat->ModuleName = ClassStats.ModuleName;
+	OwnerStat->ClassPtr = ClassStats.ClassPtr;
+	OwnerStat->Category = ClassStats.Category;
+	OwnerStat->Source = ClassStats.Source;
+	OwnerStat->bSizeAvailable = ClassStats.bSizeAvailable;
+	OwnerStat->bSizePending = ClassStats.bSizePending;
+	OwnerStat->bIsLeaking = ClassStats.bIsLeaking;
+	OwnerStat->bIsRetentionLeaking = ClassStats.bIsRetentionLeaking;
+	OwnerStat->bIsHot = ClassStats.bIsHot;
+	OwnerStat->ConsecutiveGrowthTicks = ClassStats.ConsecutiveGrowthTicks;
+	OwnerStat->ConsecutiveRetentionGrowthTicks = ClassStats.ConsecutiveRetentionGrowthTicks;
+	OwnerStat->InstanceCount = OwnerValue.InstanceCount;
+	OwnerStat->DeltaCount = OwnerValue.DeltaCount;
+	OwnerStat->TotalSizeBytes = OwnerValue.TotalSizeBytes;
+	OwnerStat->AverageSizeBytes = OwnerValue.InstanceCount > 0 ? OwnerValue.TotalSizeBytes / OwnerValue.InstanceCount : 0;
+	return OwnerStat;
+}
+
+template <typename KeyType>
+TArray<TSharedPtr<FProfilerTreeItem>> FObjectProfilerCore::BuildOwnerTreeView(const TArray<TSharedPtr<FObjectClassStats>>& Stats, TMap<KeyType, FObjectWorldStats> FObjectClassStats::* OwnerStats, FProfilerTreeItem::EItemType GroupType)
+{
+	TArray<TSharedPtr<FProfilerTreeItem>> Result;
+	TMap<KeyType, TSharedPtr<FProfilerTreeItem>> GroupMap;
+	TSharedPtr<FProfilerTreeItem> UnattributedGroup;
+	
+	auto FindOrAddGroup = [&GroupMap, GroupType](const KeyType& OwnerKey) -> TSharedPtr<FProfilerTreeItem>&
+	{
+		TSharedPtr<FProfilerTreeItem>& GroupItem = GroupMap.FindOrAdd(OwnerKey);
 		if (!GroupItem.IsValid())
 		{
 			GroupItem = MakeShared<FProfilerTreeItem>();
 			GroupItem->Type = GroupType;
-			GroupItem->DisplayName = GroupName;
+			GroupItem->DisplayName = GetOwnerLabel(OwnerKey);
+		}
+		return GroupItem;
+	};
+	
+	for (const auto& StatItem : Stats)
+	{
+		if (((*StatItem).*OwnerStats).Num() == 0)
+		{
+			if (!UnattributedGroup.IsValid())
+			{
+				UnattributedGroup = MakeShared<FProfilerTreeItem>();
+				UnattributedGroup->Type = GroupType;
+				UnattributedGroup->DisplayName = TEXT("Unattributed");
+			}
+			TSharedPtr<FProfilerTreeItem>& GroupItem = UnattributedGroup;
+			
+			TSharedPtr<FProfilerTreeItem> ClassItem = MakeShared<FProfilerTreeItem>();
+			ClassItem->Type = FProfilerTreeItem::EItemType::Class;
+			ClassItem->DisplayName = StatItem->ClassName;
+			ClassItem->Stats = StatItem;
+			ClassItem->Parent = GroupItem;
+			GroupItem->Children.Add(ClassItem);
+			continue;
 		}
 		
-		TSharedPtr<FProfilerTreeItem> ClassItem = MakeShared<FProfilerTreeItem>();
-		ClassItem->Type = FProfilerTreeItem::EItemType::Class;
-		ClassItem->DisplayName = StatItem->ClassName;
-		ClassItem->Stats = StatItem;
-		ClassItem->Parent = GroupItem;
-		
-		GroupItem->Children.Add(ClassItem);
+		for (const TPair<KeyType, FObjectWorldStats>& OwnerPair : (*StatItem).*OwnerStats)
+		{
+			TSharedPtr<FProfilerTreeItem>& GroupItem = FindOrAddGroup(OwnerPair.Key);
+			
+			TSharedPtr<FObjectClassStats> OwnerStat = MakeOwnerRowStats(*StatItem, OwnerPair.Value);
+			((*OwnerStat).*OwnerStats).Add(OwnerPair.Key, OwnerPair.Value);
+			
+			TSharedPtr<FProfilerTreeItem> ClassItem = MakeShared<FProfilerTreeItem>();
+			ClassItem->Type = FProfilerTreeItem::EItemType::Class;
+			ClassItem->DisplayName = StatItem->ClassName;
+			ClassItem->Stats = OwnerStat;
+			ClassItem->Parent = GroupItem;
+			GroupItem->Children.Add(ClassItem);
+		}
 	}
 	
 	GroupMap.GenerateValueArray(Result);
+	if (UnattributedGroup.IsValid())
+	{
+		Result.Add(UnattributedGroup);
+	}
+	
+	for (const TSharedPtr<FProfilerTreeItem>& RootItem : Result)
+	{
+		RootItem->CacheAggregates();
+	}
+	SortGroupsByCount(Result);
+	
+	return Result;
+}
+
+TArray<TSharedPtr<FProfilerTreeItem>> FObjectProfilerCore::BuildHierarchyTreeView(const TArray<TSharedPtr<FObjectClassStats>>& Stats)
+{
+	TArray<TSharedPtr<FProfilerTreeItem>> Result;
+	TMap<const FObjectClassStats*, TSharedPtr<FProfilerTreeItem>> ItemMap;
 	
-	Result.Sort([](const TSharedPtr<FProfilerTreeItem>& A, const TSharedPtr<FProfilerTreeItem>& B)
+	auto SortByInclusiveCount = [](const TSharedPtr<FProfilerTreeItem>& A, const TSharedPtr<FProfilerTreeItem>& B)
 	{
 		return A->GetAggregatedInstanceCount() > B->GetAggregatedInstanceCount();
-	});
+	};
+	
+	for (const auto& StatItem : Stats)
+	{
+		TSharedPtr<FObjectClassStats> NodeStats = StatItem;
+		TSharedPtr<FProfilerTreeItem> ChildItem;
+		
+		while (NodeStats.IsValid())
+		{
+			TSharedPtr<FProfilerTreeItem>& NodeItem = ItemMap.FindOrAdd(NodeStats.Get());
+			const bool bIsNew = !NodeItem.IsValid();
+			
+			if (bIsNew)
+			{
+				NodeItem = MakeShared<FProfilerTreeItem>();
+				NodeItem->Type = FProfilerTreeItem::EItemType::Class;
+				NodeItem->DisplayName = NodeStats->ClassName;
+				NodeItem->Stats = NodeStats;
+				NodeItem->bInclusiveTotals = true;
+			}
+			
+			if (ChildItem.IsValid())
+			{
+				ChildItem->Parent = NodeItem;
+				NodeItem->Children.Add(ChildItem);
+			}
+			
+			if (!bIsNew)
+			{
+				break;
+			}
+			
+			if (!NodeStats->SuperStats.IsValid())
+			{
+				Result.Add(NodeItem);
+			}
+			
+			ChildItem = NodeItem;
+			NodeStats = NodeStats->SuperStats;
+		}
+	}
+	
+	for (const TSharedPtr<FProfilerTreeItem>& RootItem : Result)
+	{
+		RootItem->CacheAggregates();
+	}
+	
+	for (auto& Pair : ItemMap)
+	{
+		Pair.Value->Children.Sort(SortByInclusiveCount);
+	}
+	
+	Result.Sort(SortByInclusiveCount);
 	
 	return Result;
+}
+
+void FObjectProfilerCore::ComputeHierarchyRollups(TArray<TSharedPtr<FObjectClassStats>>& Stats)
+{
+	TMap<UClass*, TSharedPtr<FObjectClassStats>> StatsByClass;
+	StatsByClass.Reserve(Stats.Num());
+	
+	for (const TSharedPtr<FObjectClassStats>& ClassStats : Stats)
+	{
+		if (!ClassStats->GetClass() && !ClassStats->ClassName.IsEmpty() && IsInGameThread())
+		{
+			ClassStats->ClassPtr = FindFirstObject<UClass>(*ClassStats->ClassName, EFindFirstObjectOptions::NativeFirst);
+		}
+		
+		if (UClass* ObjClass = ClassStats->GetClass())
+		{
+			StatsByClass.Add(ObjClass, ClassStats);
+		}
+	}
+	
+	RollupClassHierarchy(Stats, [&StatsByClass](const FObjectClassStats& Child) -> TSharedPtr<FObjectClassStats>
+	{
+		UClass* ObjClass = Child.GetClass();
+		UClass* SuperClass = ObjClass ? ObjClass->GetSuperClass() : nullptr;
+		if (!SuperClass)
+		{
+			return nullptr;
+		}
+		
+		FindOrAddClassStats(StatsByClass, SuperClass);
+		return StatsByClass.FindChecked(SuperClass);
+	});
+}
+
+void FObjectProfilerCore::RollupIncrementalHierarchy(TArray<TSharedPtr<FObjectClassStats>>& Stats, const FIncrementalCountsSnapshot& Counts)
+{
+	TMap<FName, const FIncrementalClassInfo*> InfoByName;
+	InfoByName.Reserve(Counts.Entries.Num());
+	for (const FIncrementalCountsSnapshot::FEntry& Entry : Counts.Entries)
+	{
+		InfoByName.Add(Entry.Info->ClassFName, Entry.Info.Get());
+	}
+	
+	TMap<const FObjectClassStats*, const FIncrementalClassInfo*> InfoByStats;
+	TMap<const FIncrementalClassInfo*, TSharedPtr<FObjectClassStats>> StatsByInfo;
+	
+	for (const TSharedPtr<FObjectClassStats>& ClassStats : Stats)
+	{
+		if (const FIncrementalClassInfo* Info = InfoByName.FindRef(ClassStats->ClassFName))
+		{
+			InfoByStats.Add(ClassStats.Get(), Info);
+			StatsByInfo.Add(Info, ClassStats);
+		}
+	}
+	
+	RollupClassHierarchy(Stats, [&InfoByStats, &StatsByInfo](const FObjectClassStats& Child) -> TSharedPtr<FObjectClassStats>
+	{
+		const FIncrementalClassInfo* Info = InfoByStats.FindRef(&Child);
+		const FIncrementalClassInfo* SuperInfo = Info ? Info->SuperInfo.Get() : nullptr;
+		if (!SuperInfo)
+		{
+			return nullptr;
+		}
+		
+		TSharedPtr<FObjectClassStats>& SuperStats = StatsByInfo.FindOrAdd(SuperInfo);
+		if (!SuperStats.IsValid())
+		{
+			SuperStats = MakeShared<FObjectClassStats>();
+			SuperStats->ClassName = SuperInfo->ClassName;
+			SuperStats->ClassFName = SuperInfo->ClassFName;
+			SuperStats->ClassPtr = SuperInfo->ClassPtr;
+			SuperStats->Category = SuperInfo->Category;
+			SuperStats->Source = SuperInfo->Source;
+			SuperStats->ModuleName = SuperInfo->ModuleName;
+			SuperStats->bSizeAvailable = false;
+			InfoByStats.Add(SuperStats.Get(), SuperInfo);
+		}
+		return SuperStats;
+	});
+}
+
+void FObjectProfilerCore::RollupClassHierarchy(TArray<TSharedPtr<FObjectClassStats>>& Stats, TFunctionRef<TSharedPtr<FObjectClassStats>(const FObjectClassStats&)> ResolveSuperStats)
+{
+	TArray<TSharedPtr<FObjectClassStats>> Nodes = Stats;
+	TSet<const FObjectClassStats*> Queued;
+	Queued.Reserve(Nodes.Num());
+	for (const TSharedPtr<FObjectClassStats>& Node : Nodes)
+	{
+		Queued.Add(Node.Get());
+	}
+	
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		FObjectClassStats& Node = *Nodes[NodeIndex];
+		Node.InclusiveInstanceCount = Node.InstanceCount;
+		Node.InclusiveDeltaCount = Node.DeltaCount;
+		Node.InclusiveSizeBytes = Node.bSizeAvailable ? Node.TotalSizeBytes : 0;
+		Node.InclusiveSizeBreakdown = Node.bSizeAvailable ? Node.SizeBreakdown : FObjectSizeBreakdown();
+		Node.InclusiveDeltaSizeBreakdown = Node.bSizeAvailable ? Node.DeltaSizeBreakdown : FObjectSizeBreakdown();
+		Node.SuperStats = ResolveSuperStats(Node);
+		
+		if (Node.SuperStats.IsValid() && !Queued.Contains(Node.SuperStats.Get()))
+		{
+			Queued.Add(Node.SuperStats.Get());
+			Nodes.Add(Node.SuperStats);
+		}
+	}
+	
+	TMap<const FObjectClassStats*, int32> Depths;
+	Depths.Reserve(Nodes.Num());
+	
+	TFunction<int32(const FObjectClassStats*)> GetDepth = [&Depths, &GetDepth](const FObjectClassStats* Node) -> int32
+	{
+		if (const int32* Cached = Depths.Find(Node))
+		{
+			return *Cached;
+		}
+		const int32 Depth = Node->SuperStats.IsValid() ? GetDepth(Node->SuperStats.Get()) + 1 : 0;
+		Depths.Add(Node, Depth);
+		return Depth;
+	};
+	
+	for (const TSharedPtr<FObjectClassStats>& Node : Nodes)
+	{
+		GetDepth(Node.Get());
+	}
+	
+	Nodes.Sort([&Depths](const TSharedPtr<FObjectClassStats>& A, const TSharedPtr<FObjectClassStats>& B)
+	{
+		return Depths.FindChecked(A.Get()) > Depths.FindChecked(B.Get());
+	});
+	
+	for (const TSharedPtr<FObjectClassStats>& Node : Nodes)
+	{
+		if (FObjectClassStats* Super = Node->SuperStats.Get())
+		{
+			Super->InclusiveInstanceCount += Node->InclusiveInstanceCount;
+			Super->InclusiveDeltaCount += Node->InclusiveDeltaCount;
+			Super->InclusiveSizeBytes += Node->InclusiveSizeBytes;
+			Super->InclusiveSizeBreakdown.Add(Node->InclusiveSizeBreakdown);
+			Super->InclusiveDeltaSizeBreakdown.Add(Node->InclusiveDeltaSizeBreakdown);
+		}
+	}
 }
\ No newline at end of file
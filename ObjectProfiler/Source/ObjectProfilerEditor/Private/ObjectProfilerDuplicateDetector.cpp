@@ -0,0 +1,274 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerDuplicateDetector.h"
+#include "ObjectProfilerCore.h"
+#include "ObjectProfilerGovernor.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/SoftObjectPtr.h"
+#include "UObject/LazyObjectPtr.h"
+#include "Engine/Texture.h"
+
+class FObjectProfilerDuplicateDetector::FContentWriter : public FMemoryWriter
+{
+public:
+	FContentWriter(UObject* InRoot, TArray<uint8>& InBytes)
+		: FMemoryWriter(InBytes)
+		, Root(InRoot)
+	{
+		Visited.Add(InRoot);
+	}
+
+	using FMemoryWriter::operator<<;
+
+	virtual bool ShouldSkipProperty(const FProperty* InProperty) const override
+	{
+		if (InProperty->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient))
+		{
+			return true;
+		}
+
+		const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
+		return StructProperty && StructProperty->Struct == TBaseStructure<FGuid>::Get();
+	}
+
+	virtual FArchive& operator<<(UObject*& Obj) override
+	{
+		if (!Obj)
+		{
+			FString None;
+			*this << None;
+		}
+		else if (Obj->IsIn(Root))
+		{
+			FString ClassName = Obj->GetClass()->GetPathName();
+			*this << ClassName;
+
+			bool bAlreadyVisited = false;
+			Visited.Add(Obj, &bAlreadyVisited);
+			if (!bAlreadyVisited)
+			{
+				Obj->SerializeScriptProperties(*this);
+			}
+		}
+		else
+		{
+			FString PathName = Obj == Root ? FString(TEXT("Self")) : Obj->GetPathName();
+			*this << PathName;
+		}
+		return *this;
+	}
+
+	virtual FArchive& operator<<(FLazyObjectPtr& Value) override
+	{
+		UObject* Obj = Value.Get();
+		return *this << Obj;
+	}
+
+	virtual FArchive& operator<<(FSoftObjectPtr& Value) override
+	{
+		FString PathName = Value.ToSoftObjectPath().ToString();
+		return *this << PathName;
+	}
+
+	virtual FArchive& operator<<(FSoftObjectPath& Value) override
+	{
+		FString PathName = Value.ToString();
+		return *this << PathName;
+	}
+
+	virtual FArchive& operator<<(FWeakObjectPtr& Value) override
+	{
+		UObject* Obj = Value.Get();
+		return *this << Obj;
+	}
+
+	virtual FString GetArchiveName() const override
+	{
+		return TEXT("FObjectProfilerDuplicateDetector::FContentWriter");
+	}
+
+private:
+	UObject* Root;
+	TSet<const UObject*> Visited;
+};
+
+TArray<TWeakObjectPtr<UObject>> FObjectProfilerDuplicateDetector::PendingObjects;
+int32 FObjectProfilerDuplicateDetector::NextObjectIndex = 0;
+TMap<TPair<FObjectKey, uint64>, FObjectProfilerDuplicateDetector::FPendingCluster> FObjectProfilerDuplicateDetector::Clusters;
+FOnDuplicateScanComplete FObjectProfilerDuplicateDetector::CompletionDelegate;
+FTSTicker::FDelegateHandle FObjectProfilerDuplicateDetector::TickerHandle;
+
+bool FObjectProfilerDuplicateDetector::Start(const TArray<UClass*>& Classes, FOnDuplicateScanComplete OnComplete)
+{
+	if (IsRunning())
+	{
+		return false;
+	}
+
+	PendingObjects.Reset();
+	NextObjectIndex = 0;
+	Clusters.Reset();
+	CompletionDelegate = OnComplete;
+
+	TArray<UObject*> ClassObjects;
+	for (UClass* Class : Classes)
+	{
+		if (!Class)
+		{
+			continue;
+		}
+
+		ClassObjects.Reset();
+		GetObjectsOfClass(Class, ClassObjects, false, RF_ClassDefaultObject | RF_ArchetypeObject);
+		for (UObject* Object : ClassObjects)
+		{
+			if (Object->IsAsset())
+			{
+				PendingObjects.Add(Object);
+			}
+		}
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FObjectProfilerDuplicateDetector::OnTick), 0.0f);
+	return true;
+}
+
+void FObjectProfilerDuplicateDetector::Cancel()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	PendingObjects.Empty();
+	Clusters.Empty();
+	CompletionDelegate.Unbind();
+}
+
+bool FObjectProfilerDuplicateDetector::IsRunning()
+{
+	return TickerHandle.IsValid();
+}
+
+float FObjectProfilerDuplicateDetector::GetProgress()
+{
+	return PendingObjects.Num() > 0 ? static_cast<float>(NextObjectIndex) / PendingObjects.Num() : 1.0f;
+}
+
+bool FObjectProfilerDuplicateDetector::OnTick(float DeltaTime)
+{
+	FScopedProfilerCost Cost(EProfilerCostBucket::AsyncCollection);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Budget = FObjectProfilerGovernor::ScaleWorkBudget(TickBudgetSeconds);
+
+	TArray<int32, TInlineAllocator<MaxObjectsPerTick>> ObjectIndices;
+	TArray<TArray<uint8>> Buffers;
+	TArray<int64> Sizes;
+	int64 SerializedBytes = 0;
+
+	while (NextObjectIndex < PendingObjects.Num() && ObjectIndices.Num() < MaxObjectsPerTick)
+	{
+		if (UObject* Object = PendingObjects[NextObjectIndex].Get())
+		{
+			TArray<uint8>& Buffer = Buffers.AddDefaulted_GetRef();
+			SerializeContent(Object, Buffer);
+			SerializedBytes += Buffer.Num();
+			Sizes.Add(FObjectProfilerCore::GetObjectSize(Object));
+			ObjectIndices.Add(NextObjectIndex);
+		}
+		NextObjectIndex++;
+
+		if (SerializedBytes >= MaxBytesPerTick || FPlatformTime::Seconds() - StartTime >= Budget)
+		{
+			break;
+		}
+	}
+
+	TArray<uint64> Hashes;
+	Hashes.SetNumUninitialized(Buffers.Num());
+	ParallelFor(Buffers.Num(), [&Buffers, &Hashes](int32 Index)
+	{
+		Hashes[Index] = CityHash64(reinterpret_cast<const char*>(Buffers[Index].GetData()), Buffers[Index].Num());
+	});
+
+	for (int32 Index = 0; Index < ObjectIndices.Num(); ++Index)
+	{
+		const UObject* Object = PendingObjects[ObjectIndices[Index]].Get();
+		FPendingCluster& Cluster = Clusters.FindOrAdd(TPair<FObjectKey, uint64>(FObjectKey(Object->GetClass()), Hashes[Index]));
+		if (Cluster.Members.Num() == 0)
+		{
+			Cluster.ClassName = Object->GetClass()->GetName();
+		}
+		Cluster.SizeBytes = FMath::Max(Cluster.SizeBytes, Sizes[Index]);
+		Cluster.Members.Add(ObjectIndices[Index]);
+	}
+
+	if (NextObjectIndex < PendingObjects.Num())
+	{
+		return true;
+	}
+
+	Finish();
+	return false;
+}
+
+void FObjectProfilerDuplicateDetector::SerializeContent(UObject* Object, TArray<uint8>& OutBuffer)
+{
+	FContentWriter Writer(Object, OutBuffer);
+
+	// Texture sources hash their pixels into the source id; the bulk data itself carries a per-asset guid.
+	if (UTexture* Texture = Cast<UTexture>(Object))
+	{
+		FGuid SourceId = Texture->Source.GetId();
+		Writer << SourceId;
+		Object->SerializeScriptProperties(Writer);
+		return;
+	}
+
+	Object->Serialize(Writer);
+}
+
+void FObjectProfilerDuplicateDetector::Finish()
+{
+	TickerHandle.Reset();
+
+	TArray<FDuplicateCluster> Results;
+	for (const TPair<TPair<FObjectKey, uint64>, FPendingCluster>& Pair : Clusters)
+	{
+		if (Pair.Value.Members.Num() < 2)
+		{
+			continue;
+		}
+
+		FDuplicateCluster& Cluster = Results.AddDefaulted_GetRef();
+		Cluster.ClassName = Pair.Value.ClassName;
+		Cluster.ContentHash = Pair.Key.Value;
+		Cluster.SizeBytes = Pair.Value.SizeBytes;
+
+		for (const int32 MemberIndex : Pair.Value.Members)
+		{
+			if (const UObject* Member = PendingObjects[MemberIndex].Get())
+			{
+				Cluster.ObjectPaths.Add(Member->GetPathName());
+			}
+		}
+	}
+
+	Results.RemoveAll([](const FDuplicateCluster& Cluster) { return Cluster.ObjectPaths.Num() < 2; });
+	Results.Sort([](const FDuplicateCluster& A, const FDuplicateCluster& B)
+	{
+		return A.GetWastedBytes() > B.GetWastedBytes();
+	});
+
+	PendingObjects.Empty();
+	Clusters.Empty();
+
+	FOnDuplicateScanComplete Delegate = CompletionDelegate;
+	CompletionDelegate.Unbind();
+	Delegate.ExecuteIfBound(Results);
+}
\ No newline at end of file
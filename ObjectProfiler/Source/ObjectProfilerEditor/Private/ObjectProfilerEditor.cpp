@@ -3,6 +3,8 @@
 #include "ObjectProfilerEditor.h"
 #include "ObjectProfilerCommands.h"
 #include "ObjectProfilerCore.h"
+#include "ObjectProfilerEventLog.h"
+#include "ObjectProfilerGovernor.h"
 #include "SObjectProfilerWindow.h"
 
 #include "Framework/Docking/TabManager.h"
@@ -19,6 +21,7 @@ const FName FObjectProfilerEditorModule::ProfilerTabName("ObjectProfilerTab");
 void FObjectProfilerEditorModule::StartupModule()
 {
 	FObjectProfilerCommands::Register();
+	FObjectProfilerGovernor::Start();
 
 	PluginCommands = MakeShareable(new FUICommandList);
 
@@ -61,6 +64,10 @@ void FObjectProfilerEditorModule::ShutdownModule()
 	FObjectProfilerCommands::Unregister();
 
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(ProfilerTabName);
+
+	FObjectEventRecorder::StopRecording();
+	FObjectProfilerCore::ResetDefaultSession();
+	FObjectProfilerGovernor::Stop();
 }
 
 void FObjectProfilerEditorModule::RegisterMenus()
@@ -99,9 +106,9 @@ void FObjectProfilerEditorModule::OpenProfilerWindow()
 
 void FObjectProfilerEditorModule::TakeQuickSnapshot()
 {
-	FObjectProfilerCore::TakeSnapshot(FString::Printf(TEXT("Quick_%s"), *FDateTime::Now().ToString(TEXT("%H%M%S"))));
+	FObjectProfilerCore::RequestSnapshot(FString::Printf(TEXT("Quick_%s"), *FDateTime::Now().ToString(TEXT("%H%M%S"))));
 	
-	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Quick snapshot taken via hotkey"));
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Quick snapshot requested via hotkey"));
 }
 
 void FObjectProfilerEditorModule::ForceGarbageCollection()
@@ -0,0 +1,683 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerEventLog.h"
+#include "UObject/UObjectIterator.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace ObjectEventLog
+{
+	constexpr uint32 Magic = 0x45504F55;
+	constexpr uint32 Version = 1;
+	constexpr int32 HeaderSize = sizeof(uint32) * 2 + sizeof(uint64) + sizeof(double) + sizeof(int64);
+
+	FORCEINLINE int32 EncodeVarInt(uint8* Out, uint64 Value)
+	{
+		int32 Length = 0;
+		while (Value >= 0x80)
+		{
+			Out[Length++] = static_cast<uint8>(Value | 0x80);
+			Value >>= 7;
+		}
+		Out[Length++] = static_cast<uint8>(Value);
+		return Length;
+	}
+
+	FORCEINLINE bool DecodeVarInt(const uint8*& Cursor, const uint8* End, uint64& OutValue)
+	{
+		OutValue = 0;
+		int32 Shift = 0;
+		while (Cursor < End && Shift < 64)
+		{
+			const uint8 Byte = *Cursor++;
+			OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0)
+			{
+				return true;
+			}
+			Shift += 7;
+		}
+		return false;
+	}
+
+	template<typename T>
+	void WriteRaw(TArray<uint8>& Buffer, const T& Value)
+	{
+		Buffer.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+	}
+
+	template<typename T>
+	T ReadRaw(const uint8*& Cursor)
+	{
+		T Value;
+		FMemory::Memcpy(&Value, Cursor, sizeof(T));
+		Cursor += sizeof(T);
+		return Value;
+	}
+}
+
+FCriticalSection FObjectEventRecorder::BufferLock;
+TArray<uint8> FObjectEventRecorder::ActiveBuffer;
+TArray<TArray<uint8>> FObjectEventRecorder::PendingBuffers;
+TArray<TArray<uint8>> FObjectEventRecorder::SpareBuffers;
+TMap<const UClass*, uint32> FObjectEventRecorder::ClassIds;
+const UClass* FObjectEventRecorder::LastClass = nullptr;
+uint32 FObjectEventRecorder::LastClassId = 0;
+uint64 FObjectEventRecorder::LastEventCycles = 0;
+int64 FObjectEventRecorder::EventCount = 0;
+int64 FObjectEventRecorder::BytesWritten = 0;
+IFileHandle* FObjectEventRecorder::FileHandle = nullptr;
+FString FObjectEventRecorder::RecordingPath;
+bool FObjectEventRecorder::bRecording = false;
+FObjectEventRecorder::FRecorderCreateListener* FObjectEventRecorder::CreateListener = nullptr;
+FObjectEventRecorder::FRecorderDeleteListener* FObjectEventRecorder::DeleteListener = nullptr;
+FTSTicker::FDelegateHandle FObjectEventRecorder::FlushTickerHandle;
+
+void FObjectEventRecorder::FRecorderCreateListener::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
+{
+	if (Object && !(Object->GetFlags() & (RF_ClassDefaultObject | RF_ArchetypeObject)))
+	{
+		AppendEvent(EObjectEventType::Created, Object, Index);
+	}
+}
+
+void FObjectEventRecorder::FRecorderCreateListener::OnUObjectArrayShutdown()
+{
+	GUObjectArray.RemoveUObjectCreateListener(this);
+}
+
+void FObjectEventRecorder::FRecorderDeleteListener::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
+{
+	if (Object && !(Object->GetFlags() & (RF_ClassDefaultObject | RF_ArchetypeObject)))
+	{
+		AppendEvent(EObjectEventType::Deleted, Object, Index);
+	}
+}
+
+void FObjectEventRecorder::FRecorderDeleteListener::OnUObjectArrayShutdown()
+{
+	GUObjectArray.RemoveUObjectDeleteListener(this);
+}
+
+FString FObjectEventRecorder::GetDefaultRecordingDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ObjectProfiler");
+}
+
+bool FObjectEventRecorder::StartRecording(const FString& FilePath)
+{
+	if (bRecording)
+	{
+		return true;
+	}
+
+	RecordingPath = FilePath.IsEmpty()
+		? GetDefaultRecordingDirectory() / FString::Printf(TEXT("Events_%s.uoplog"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")))
+		: FilePath;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(RecordingPath));
+
+	FileHandle = PlatformFile.OpenWrite(*RecordingPath);
+	if (!FileHandle)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ObjectProfiler: Failed to open event log '%s'"), *RecordingPath);
+		return false;
+	}
+
+	{
+		FScopeLock Lock(&BufferLock);
+
+		ActiveBuffer.Empty(BufferCapacity + 64);
+		PendingBuffers.Empty();
+		ClassIds.Empty();
+		LastClass = nullptr;
+		EventCount = 0;
+		BytesWritten = 0;
+		LastEventCycles = FPlatformTime::Cycles64();
+
+		ObjectEventLog::WriteRaw(ActiveBuffer, ObjectEventLog::Magic);
+		ObjectEventLog::WriteRaw(ActiveBuffer, ObjectEventLog::Version);
+		ObjectEventLog::WriteRaw(ActiveBuffer, LastEventCycles);
+		ObjectEventLog::WriteRaw(ActiveBuffer, FPlatformTime::GetSecondsPerCycle64());
+		ObjectEventLog::WriteRaw(ActiveBuffer, FDateTime::Now().GetTicks());
+
+		for (TObjectIterator<UObject> It; It; ++It)
+		{
+			UObject* Obj = *It;
+			if (IsValid(Obj) && !Obj->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+			{
+				WriteEvent(EObjectEventType::Created, Obj, GUObjectArray.ObjectToIndex(Obj), 0);
+			}
+		}
+
+		bRecording = true;
+	}
+
+	CreateListener = new FRecorderCreateListener();
+	DeleteListener = new FRecorderDeleteListener();
+
+	GUObjectArray.AddUObjectCreateListener(CreateListener);
+	GUObjectArray.AddUObjectDeleteListener(DeleteListener);
+
+	FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateStatic(&FObjectEventRecorder::OnFlushTick),
+		FlushIntervalSeconds
+	);
+
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Event recording started to '%s' (%lld baseline objects)"), *RecordingPath, EventCount);
+	return true;
+}
+
+void FObjectEventRecorder::StopRecording()
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	if (CreateListener)
+	{
+		GUObjectArray.RemoveUObjectCreateListener(CreateListener);
+		delete CreateListener;
+		CreateListener = nullptr;
+	}
+
+	if (DeleteListener)
+	{
+		GUObjectArray.RemoveUObjectDeleteListener(DeleteListener);
+		delete DeleteListener;
+		DeleteListener = nullptr;
+	}
+
+	{
+		FScopeLock Lock(&BufferLock);
+		bRecording = false;
+	}
+
+	WritePendingBuffers();
+
+	{
+		FScopeLock Lock(&BufferLock);
+		delete FileHandle;
+		FileHandle = nullptr;
+		ClassIds.Empty();
+		LastClass = nullptr;
+		ActiveBuffer.Empty();
+		PendingBuffers.Empty();
+		SpareBuffers.Empty();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Event recording stopped (%lld events, %s)"),
+		EventCount, *FString::Printf(TEXT("%.2f MB"), BytesWritten / (1024.0 * 1024.0)));
+}
+
+bool FObjectEventRecorder::IsRecording()
+{
+	return bRecording;
+}
+
+FString FObjectEventRecorder::GetRecordingPath()
+{
+	return RecordingPath;
+}
+
+int64 FObjectEventRecorder::GetRecordedEventCount()
+{
+	return EventCount;
+}
+
+int64 FObjectEventRecorder::GetRecordedBytes()
+{
+	FScopeLock Lock(&BufferLock);
+
+	int64 BufferedBytes = ActiveBuffer.Num();
+	for (const TArray<uint8>& Buffer : PendingBuffers)
+	{
+		BufferedBytes += Buffer.Num();
+	}
+	return BytesWritten + BufferedBytes;
+}
+
+uint32 FObjectEventRecorder::GetOrAssignClassId(const UClass* InClass)
+{
+	if (InClass == LastClass)
+	{
+		return LastClassId;
+	}
+
+	LastClass = InClass;
+
+	if (const uint32* ExistingId = ClassIds.Find(InClass))
+	{
+		LastClassId = *ExistingId;
+		return LastClassId;
+	}
+
+	const uint32 NewId = ClassIds.Num();
+	ClassIds.Add(InClass, NewId);
+	LastClassId = NewId;
+
+	const FTCHARToUTF8 ClassName(InClass ? *InClass->GetName() : TEXT("None"));
+
+	uint8 Scratch[32];
+	int32 Length = ObjectEventLog::EncodeVarInt(Scratch, static_cast<uint64>(EObjectEventType::ClassDefinition));
+	Length += ObjectEventLog::EncodeVarInt(Scratch + Length, NewId);
+	Length += ObjectEventLog::EncodeVarInt(Scratch + Length, ClassName.Length());
+	ActiveBuffer.Append(Scratch, Length);
+	ActiveBuffer.Append(reinterpret_cast<const uint8*>(ClassName.Get()), ClassName.Length());
+
+	return NewId;
+}
+
+void FObjectEventRecorder::AppendEvent(EObjectEventType Type, const UObjectBase* Object, int32 Index)
+{
+	FScopeLock Lock(&BufferLock);
+
+	if (!bRecording)
+	{
+		return;
+	}
+
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	const uint64 DeltaCycles = NowCycles > LastEventCycles ? NowCycles - LastEventCycles : 0;
+	LastEventCycles = FMath::Max(NowCycles, LastEventCycles);
+
+	WriteEvent(Type, Object, Index, DeltaCycles);
+}
+
+void FObjectEventRecorder::WriteEvent(EObjectEventType Type, const UObjectBase* Object, int32 Index, uint64 DeltaCycles)
+{
+	const int32 SerialNumber = Index >= 0 ? GUObjectArray.GetSerialNumber(Index) : 0;
+	const uint32 ClassId = GetOrAssignClassId(Object->GetClass());
+
+	uint8 Scratch[48];
+	int32 Length = ObjectEventLog::EncodeVarInt(Scratch, (DeltaCycles << 2) | static_cast<uint64>(Type));
+	Length += ObjectEventLog::EncodeVarInt(Scratch + Length, ClassId);
+	Length += ObjectEventLog::EncodeVarInt(Scratch + Length, static_cast<uint32>(Index));
+	Length += ObjectEventLog::EncodeVarInt(Scratch + Length, static_cast<uint32>(SerialNumber));
+	ActiveBuffer.Append(Scratch, Length);
+
+	EventCount++;
+
+	if (ActiveBuffer.Num() >= BufferCapacity)
+	{
+		RetireActiveBuffer();
+	}
+}
+
+void FObjectEventRecorder::RetireActiveBuffer()
+{
+	PendingBuffers.Add(MoveTemp(ActiveBuffer));
+
+	if (SpareBuffers.Num() > 0)
+	{
+		ActiveBuffer = MoveTemp(SpareBuffers.Last());
+		SpareBuffers.Pop();
+	}
+	else
+	{
+		ActiveBuffer = TArray<uint8>();
+		ActiveBuffer.Reserve(BufferCapacity + 64);
+	}
+}
+
+void FObjectEventRecorder::WritePendingBuffers()
+{
+	TArray<TArray<uint8>> BuffersToWrite;
+	{
+		FScopeLock Lock(&BufferLock);
+
+		if (ActiveBuffer.Num() > 0)
+		{
+			RetireActiveBuffer();
+		}
+		BuffersToWrite = MoveTemp(PendingBuffers);
+	}
+
+	for (TArray<uint8>& Buffer : BuffersToWrite)
+	{
+		if (FileHandle)
+		{
+			FileHandle->Write(Buffer.GetData(), Buffer.Num());
+		}
+		BytesWritten += Buffer.Num();
+	}
+
+	if (FileHandle && BuffersToWrite.Num() > 0)
+	{
+		FileHandle->Flush();
+	}
+
+	FScopeLock Lock(&BufferLock);
+	for (TArray<uint8>& Buffer : BuffersToWrite)
+	{
+		if (SpareBuffers.Num() >= MaxSpareBuffers)
+		{
+			break;
+		}
+		Buffer.Reset();
+		SpareBuffers.Add(MoveTemp(Buffer));
+	}
+}
+
+bool FObjectEventRecorder::OnFlushTick(float DeltaTime)
+{
+	if (!bRecording)
+	{
+		return false;
+	}
+
+	WritePendingBuffers();
+	return true;
+}
+
+void FObjectEventReplay::Reset()
+{
+	EventCycles.Empty();
+	EventClassAndType.Empty();
+	ClassNames.Empty();
+	ClassNameToId.Empty();
+	Checkpoints.Empty();
+	StartCycles = 0;
+	SecondsPerCycle = 0.0;
+	bLoaded = false;
+}
+
+bool FObjectEventReplay::LoadFromFile(const FString& FilePath)
+{
+	Reset();
+
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath) || FileData.Num() < ObjectEventLog::HeaderSize)
+	{
+		return false;
+	}
+
+	const uint8* Cursor = FileData.GetData();
+	const uint8* End = Cursor + FileData.Num();
+
+	if (ObjectEventLog::ReadRaw<uint32>(Cursor) != ObjectEventLog::Magic ||
+		ObjectEventLog::ReadRaw<uint32>(Cursor) != ObjectEventLog::Version)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ObjectProfiler: '%s' is not a supported event log"), *FilePath);
+		return false;
+	}
+
+	StartCycles = ObjectEventLog::ReadRaw<uint64>(Cursor);
+	SecondsPerCycle = ObjectEventLog::ReadRaw<double>(Cursor);
+	RecordingStartTime = FDateTime(ObjectEventLog::ReadRaw<int64>(Cursor));
+
+	const int64 EstimatedEvents = FileData.Num() / 8;
+	EventCycles.Reserve(EstimatedEvents);
+	EventClassAndType.Reserve(EstimatedEvents);
+
+	TArray<int32> IdToSlot;
+	uint64 CurrentCycles = StartCycles;
+
+	while (Cursor < End)
+	{
+		uint64 Header = 0;
+		if (!ObjectEventLog::DecodeVarInt(Cursor, End, Header))
+		{
+			break;
+		}
+
+		const EObjectEventType Type = static_cast<EObjectEventType>(Header & 0x3);
+
+		if (Type == EObjectEventType::ClassDefinition)
+		{
+			uint64 ClassId = 0;
+			uint64 NameLength = 0;
+			if (!ObjectEventLog::DecodeVarInt(Cursor, End, ClassId) ||
+				!ObjectEventLog::DecodeVarInt(Cursor, End, NameLength) ||
+				Cursor + NameLength > End)
+			{
+				break;
+			}
+
+			const FUTF8ToTCHAR ConvertedName(reinterpret_cast<const ANSICHAR*>(Cursor), static_cast<int32>(NameLength));
+			const FString ClassName(ConvertedName.Length(), ConvertedName.Get());
+			Cursor += NameLength;
+
+			int32& Slot = ClassNameToId.FindOrAdd(ClassName, INDEX_NONE);
+			if (Slot == INDEX_NONE)
+			{
+				Slot = ClassNames.Add(ClassName);
+			}
+
+			if (IdToSlot.Num() <= static_cast<int32>(ClassId))
+			{
+				IdToSlot.SetNum(static_cast<int32>(ClassId) + 1);
+			}
+			IdToSlot[static_cast<int32>(ClassId)] = Slot;
+			continue;
+		}
+
+		uint64 ClassId = 0;
+		uint64 ObjectIndex = 0;
+		uint64 SerialNumber = 0;
+		if (!ObjectEventLog::DecodeVarInt(Cursor, End, ClassId) ||
+			!ObjectEventLog::DecodeVarInt(Cursor, End, ObjectIndex) ||
+			!ObjectEventLog::DecodeVarInt(Cursor, End, SerialNumber) ||
+			ClassId >= static_cast<uint64>(IdToSlot.Num()))
+		{
+			break;
+		}
+
+		CurrentCycles += Header >> 2;
+		EventCycles.Add(CurrentCycles);
+		EventClassAndType.Add((static_cast<uint32>(IdToSlot[static_cast<int32>(ClassId)]) << 1) | (Type == EObjectEventType::Deleted ? 1u : 0u));
+	}
+
+	const int32 NumEvents = EventCycles.Num();
+	TArray<int32> RunningCounts;
+	RunningCounts.SetNumZeroed(ClassNames.Num());
+
+	for (int32 EventIndex = 0; EventIndex < NumEvents; ++EventIndex)
+	{
+		if ((EventIndex & ((1 << CheckpointShift) - 1)) == 0)
+		{
+			Checkpoints.Add(RunningCounts);
+		}
+
+		const uint32 Packed = EventClassAndType[EventIndex];
+		RunningCounts[Packed >> 1] += (Packed & 1) ? -1 : 1;
+	}
+
+	bLoaded = true;
+
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Loaded event log '%s' (%d events, %d classes, %.1fs)"),
+		*FilePath, NumEvents, ClassNames.Num(), GetDuration());
+	return true;
+}
+
+double FObjectEventReplay::CyclesToSeconds(uint64 Cycles) const
+{
+	return static_cast<double>(Cycles - StartCycles) * SecondsPerCycle;
+}
+
+double FObjectEventReplay::GetDuration() const
+{
+	return EventCycles.Num() > 0 ? CyclesToSeconds(EventCycles.Last()) : 0.0;
+}
+
+int32 FObjectEventReplay::FindEventIndexAt(double Seconds) const
+{
+	if (SecondsPerCycle <= 0.0)
+	{
+		return 0;
+	}
+
+	const uint64 TargetCycles = StartCycles + static_cast<uint64>(FMath::Max(0.0, Seconds) / SecondsPerCycle);
+	return Algo::UpperBound(EventCycles, TargetCycles);
+}
+
+void FObjectEventReplay::ComputeCountsAt(int32 EventIndex, TArray<int32>& OutCounts) const
+{
+	const int32 CheckpointIndex = FMath::Min(EventIndex >> CheckpointShift, Checkpoints.Num() - 1);
+	if (CheckpointIndex < 0)
+	{
+		OutCounts.SetNumZeroed(ClassNames.Num());
+		return;
+	}
+
+	OutCounts = Checkpoints[CheckpointIndex];
+	OutCounts.SetNumZeroed(ClassNames.Num());
+
+	for (int32 i = CheckpointIndex << CheckpointShift; i < EventIndex; ++i)
+	{
+		const uint32 Packed = EventClassAndType[i];
+		OutCounts[Packed >> 1] += (Packed & 1) ? -1 : 1;
+	}
+}
+
+TMap<FString, int32> FObjectEventReplay::GetClassCountsAt(double Seconds) const
+{
+	TMap<FString, int32> Result;
+
+	TArray<int32> Counts;
+	ComputeCountsAt(FindEventIndexAt(Seconds), Counts);
+
+	for (int32 ClassSlot = 0; ClassSlot < Counts.Num(); ++ClassSlot)
+	{
+		if (Counts[ClassSlot] > 0)
+		{
+			Result.Add(ClassNames[ClassSlot], Counts[ClassSlot]);
+		}
+	}
+
+	return Result;
+}
+
+TArray<FObjectHistoryPoint> FObjectEventReplay::GetClassCountOverTime(const FString& ClassName, double StartSeconds, double EndSeconds, int32 NumPoints) const
+{
+	TArray<FObjectHistoryPoint> Result;
+
+	const int32* ClassSlotPtr = ClassNameToId.Find(ClassName);
+	if (!ClassSlotPtr || NumPoints < 1 || Checkpoints.Num() == 0)
+	{
+		return Result;
+	}
+
+	const uint32 ClassSlot = static_cast<uint32>(*ClassSlotPtr);
+	const double Step = NumPoints > 1 ? (EndSeconds - StartSeconds) / (NumPoints - 1) : 0.0;
+
+	Result.Reserve(NumPoints);
+
+	int32 Count = 0;
+	int32 AppliedUpTo = 0;
+
+	for (int32 PointIndex = 0; PointIndex < NumPoints; ++PointIndex)
+	{
+		const double Seconds = StartSeconds + Step * PointIndex;
+		const int32 EventIndex = FindEventIndexAt(Seconds);
+
+		const int32 CheckpointIndex = FMath::Min(EventIndex >> CheckpointShift, Checkpoints.Num() - 1);
+		const int32 CheckpointStart = CheckpointIndex << CheckpointShift;
+		if (CheckpointStart > AppliedUpTo || PointIndex == 0)
+		{
+			const TArray<int32>& Checkpoint = Checkpoints[CheckpointIndex];
+			Count = Checkpoint.IsValidIndex(ClassSlot) ? Checkpoint[ClassSlot] : 0;
+			AppliedUpTo = CheckpointStart;
+		}
+
+		for (int32 i = AppliedUpTo; i < EventIndex; ++i)
+		{
+			const uint32 Packed = EventClassAndType[i];
+			if ((Packed >> 1) == ClassSlot)
+			{
+				Count += (Packed & 1) ? -1 : 1;
+			}
+		}
+		AppliedUpTo = FMath::Max(AppliedUpTo, EventIndex);
+
+		FObjectHistoryPoint Point;
+		Point.InstanceCount = Count;
+		Point.Timestamp = Seconds;
+		Result.Add(Point);
+	}
+
+	return Result;
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectEventReplay::Diff(double SecondsA, double SecondsB) const
+{
+	TArray<TSharedPtr<FObjectClassStats>> Result;
+
+	TArray<int32> CountsA;
+	TArray<int32> CountsB;
+	ComputeCountsAt(FindEventIndexAt(SecondsA), CountsA);
+	ComputeCountsAt(FindEventIndexAt(SecondsB), CountsB);
+
+	TMap<int32, TSharedPtr<FObjectClassStats>> ChangedClasses;
+
+	for (int32 ClassSlot = 0; ClassSlot < ClassNames.Num(); ++ClassSlot)
+	{
+		const int32 Delta = CountsB[ClassSlot] - CountsA[ClassSlot];
+		if (Delta != 0)
+		{
+			TSharedPtr<FObjectClassStats> Stats = MakeShared<FObjectClassStats>();
+			Stats->ClassName = ClassNames[ClassSlot];
+			Stats->InstanceCount = Delta;
+			Stats->DeltaCount = Delta;
+			Stats->bSizeAvailable = false;
+			ChangedClasses.Add(ClassSlot, Stats);
+			Result.Add(Stats);
+		}
+	}
+
+	if (ChangedClasses.Num() == 0 || SecondsB <= SecondsA)
+	{
+		return Result;
+	}
+
+	const int32 NumPoints = FObjectClassStats::MaxHistorySize;
+	const double Step = (SecondsB - SecondsA) / (NumPoints - 1);
+
+	TArray<int32> RunningCounts = CountsA;
+	int32 EventIndex = FindEventIndexAt(SecondsA);
+
+	for (int32 PointIndex = 0; PointIndex < NumPoints; ++PointIndex)
+	{
+		const double Seconds = SecondsA + Step * PointIndex;
+		const int32 EndIndex = FindEventIndexAt(Seconds);
+
+		for (; EventIndex < EndIndex; ++EventIndex)
+		{
+			const uint32 Packed = EventClassAndType[EventIndex];
+			RunningCounts[Packed >> 1] += (Packed & 1) ? -1 : 1;
+		}
+
+		for (auto& [ClassSlot, Stats] : ChangedClasses)
+		{
+			Stats->AddHistoryPoint(RunningCounts[ClassSlot], 0, Seconds);
+		}
+	}
+
+	return Result;
+}
+
+FObjectSnapshot FObjectEventReplay::BuildSnapshotAt(double Seconds, const FString& SnapshotName) const
+{
+	FObjectSnapshot Snapshot;
+	Snapshot.Name = SnapshotName;
+	Snapshot.Timestamp = RecordingStartTime + FTimespan::FromSeconds(Seconds);
+	Snapshot.ClassCounts = GetClassCountsAt(Seconds);
+
+	for (const auto& [ClassName, Count] : Snapshot.ClassCounts)
+	{
+		Snapshot.TotalObjects += Count;
+	}
+
+	return Snapshot;
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerGovernor.h"
+#include "Misc/ConfigCacheIni.h"
+
+std::atomic<uint64> FObjectProfilerGovernor::PendingCycles[static_cast<int32>(EProfilerCostBucket::Num)] = {};
+double FObjectProfilerGovernor::SmoothedShare[static_cast<int32>(EProfilerCostBucket::Num)] = {};
+double FObjectProfilerGovernor::SmoothedTotalShare = 0.0;
+
+float FObjectProfilerGovernor::BudgetPercent = FObjectProfilerGovernor::DefaultBudgetPercent;
+int32 FObjectProfilerGovernor::ThrottleLevel = 0;
+double FObjectProfilerGovernor::LastLevelChangeTime = 0.0;
+FTSTicker::FDelegateHandle FObjectProfilerGovernor::FrameTickerHandle;
+
+void FObjectProfilerGovernor::Start()
+{
+	if (FrameTickerHandle.IsValid())
+	{
+		return;
+	}
+	
+	if (GConfig)
+	{
+		GConfig->GetFloat(TEXT("ObjectProfiler"), TEXT("OverheadBudgetPercent"), BudgetPercent, GEngineIni);
+	}
+	
+	for (std::atomic<uint64>& Cycles : PendingCycles)
+	{
+		Cycles.store(0, std::memory_order_relaxed);
+	}
+	
+	LastLevelChangeTime = FPlatformTime::Seconds();
+	FrameTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateStatic(&FObjectProfilerGovernor::OnFrameTick));
+}
+
+void FObjectProfilerGovernor::Stop()
+{
+	if (FrameTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FrameTickerHandle);
+		FrameTickerHandle.Reset();
+	}
+	
+	ThrottleLevel = 0;
+	SmoothedTotalShare = 0.0;
+}
+
+void FObjectProfilerGovernor::SetBudgetPercent(float Percent)
+{
+	BudgetPercent = FMath::Max(0.0f, Percent);
+	
+	if (!IsEnabled())
+	{
+		SetThrottleLevel(0);
+	}
+}
+
+float FObjectProfilerGovernor::GetBudgetPercent()
+{
+	return BudgetPercent;
+}
+
+bool FObjectProfilerGovernor::IsEnabled()
+{
+	return BudgetPercent > 0.0f;
+}
+
+void FObjectProfilerGovernor::AddCost(EProfilerCostBucket Bucket, uint64 Cycles)
+{
+	PendingCycles[static_cast<int32>(Bucket)].fetch_add(Cycles, std::memory_order_relaxed);
+}
+
+int32 FObjectProfilerGovernor::GetThrottleLevel()
+{
+	return ThrottleLevel;
+}
+
+float FObjectProfilerGovernor::GetIntervalScale()
+{
+	return static_cast<float>(1 << ThrottleLevel);
+}
+
+int32 FObjectProfilerGovernor::ScaleWorkChunk(int32 ChunkSize)
+{
+	return FMath::Max(FMath::Min(ChunkSize, MinWorkChunk), ChunkSize >> ThrottleLevel);
+}
+
+double FObjectProfilerGovernor::ScaleWorkBudget(double BudgetSeconds)
+{
+	return BudgetSeconds / static_cast<double>(1 << ThrottleLevel);
+}
+
+bool FObjectProfilerGovernor::ShouldDeferSizing()
+{
+	return ThrottleLevel >= DeferSizingLevel;
+}
+
+float FObjectProfilerGovernor::GetSmoothedCostPercent()
+{
+	return static_cast<float>(SmoothedTotalShare * 100.0);
+}
+
+FString FObjectProfilerGovernor::GetStatusText()
+{
+	if (!IsEnabled())
+	{
+		return FString();
+	}
+	
+	FString Status = FString::Printf(TEXT("Overhead: %.1f%% of %.1f%%"), GetSmoothedCostPercent(), BudgetPercent);
+	
+	if (ThrottleLevel > 0)
+	{
+		static const TCHAR* BucketNames[] = { TEXT("listeners"), TEXT("collection"), TEXT("real-time"), TEXT("UI") };
+		int32 CostliestBucket = 0;
+		for (int32 BucketIndex = 1; BucketIndex < static_cast<int32>(EProfilerCostBucket::Num); ++BucketIndex)
+		{
+			if (SmoothedShare[BucketIndex] > SmoothedShare[CostliestBucket])
+			{
+				CostliestBucket = BucketIndex;
+			}
+		}
+		
+		Status += FString::Printf(TEXT(" (throttled by %s: interval x%d, work 1/%d%s)"),
+			BucketNames[CostliestBucket], 1 << ThrottleLevel, 1 << ThrottleLevel,
+			ShouldDeferSizing() ? TEXT(", sizing deferred") : TEXT(""));
+	}
+	
+	return Status;
+}
+
+bool FObjectProfilerGovernor::OnFrameTick(float DeltaTime)
+{
+	if (DeltaTime <= 0.0f)
+	{
+		return true;
+	}
+	
+	const double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+	double TotalShare = 0.0;
+	
+	for (int32 BucketIndex = 0; BucketIndex < static_cast<int32>(EProfilerCostBucket::Num); ++BucketIndex)
+	{
+		const double Share = PendingCycles[BucketIndex].exchange(0, std::memory_order_relaxed) * SecondsPerCycle / DeltaTime;
+		SmoothedShare[BucketIndex] += (Share - SmoothedShare[BucketIndex]) * SmoothingFactor;
+		TotalShare += Share;
+	}
+	
+	SmoothedTotalShare += (TotalShare - SmoothedTotalShare) * SmoothingFactor;
+	
+	if (!IsEnabled())
+	{
+		return true;
+	}
+	
+	const double Budget = BudgetPercent / 100.0;
+	const double SinceLastChange = FPlatformTime::Seconds() - LastLevelChangeTime;
+	
+	if (SmoothedTotalShare > Budget && ThrottleLevel < MaxThrottleLevel && SinceLastChange >= EscalateDelaySeconds)
+	{
+		SetThrottleLevel(ThrottleLevel + 1);
+	}
+	else if (SmoothedTotalShare < Budget * RelaxHeadroom && ThrottleLevel > 0 && SinceLastChange >= RelaxDelaySeconds)
+	{
+		SetThrottleLevel(ThrottleLevel - 1);
+	}
+	
+	return true;
+}
+
+void FObjectProfilerGovernor::SetThrottleLevel(int32 NewLevel)
+{
+	NewLevel = FMath::Clamp(NewLevel, 0, MaxThrottleLevel);
+	if (NewLevel == ThrottleLevel)
+	{
+		return;
+	}
+	
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Overhead %.2f%% (budget %.2f%%), throttle level %d -> %d"),
+		GetSmoothedCostPercent(), BudgetPercent, ThrottleLevel, NewLevel);
+	
+	ThrottleLevel = NewLevel;
+	LastLevelChangeTime = FPlatformTime::Seconds();
+}
\ No newline at end of file
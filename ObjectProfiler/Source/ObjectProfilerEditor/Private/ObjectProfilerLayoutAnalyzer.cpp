@@ -0,0 +1,185 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerLayoutAnalyzer.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectAllocator.h"
+
+TArray<FClassLayoutReport> FObjectProfilerLayoutAnalyzer::Analyze(const TArray<TSharedPtr<FObjectClassStats>>& Stats, int32 MinInstanceCount)
+{
+	TArray<FClassLayoutReport> Reports;
+
+	for (const TSharedPtr<FObjectClassStats>& ClassStats : Stats)
+	{
+		const UClass* Class = ClassStats.IsValid() ? ClassStats->GetClass() : nullptr;
+		if (!Class || ClassStats->InstanceCount < MinInstanceCount)
+		{
+			continue;
+		}
+
+		FClassLayoutReport& Report = Reports.AddDefaulted_GetRef();
+		Report.ClassName = ClassStats->ClassName;
+		Report.InstanceCount = ClassStats->InstanceCount;
+		Report.PropertiesSize = Class->GetPropertiesSize();
+		Report.MinAlignment = FMath::Max(1, Class->GetMinAlignment());
+
+		FindPaddingGaps(Class, Report);
+		MeasureAllocation(*ClassStats, Report);
+		SuggestOrdering(Class, Report);
+	}
+
+	Reports.Sort([](const FClassLayoutReport& A, const FClassLayoutReport& B)
+	{
+		return A.GetTotalWasteBytes() > B.GetTotalWasteBytes();
+	});
+
+	return Reports;
+}
+
+void FObjectProfilerLayoutAnalyzer::FindPaddingGaps(const UClass* Class, FClassLayoutReport& OutReport)
+{
+	TArray<const FProperty*> Properties;
+	for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		Properties.Add(*It);
+	}
+
+	Properties.StableSort([](const FProperty& A, const FProperty& B)
+	{
+		return A.GetOffset_ForInternal() < B.GetOffset_ForInternal();
+	});
+
+	int32 Cursor = UObject::StaticClass()->GetPropertiesSize();
+	FString PreviousName = TEXT("UObject");
+
+	auto AddGap = [&OutReport, &PreviousName](int32 Offset, int32 Size, int32 Alignment)
+	{
+		FClassLayoutGap& Gap = OutReport.Gaps.AddDefaulted_GetRef();
+		Gap.AfterProperty = PreviousName;
+		Gap.Offset = Offset;
+		Gap.Size = Size;
+		Gap.bUnreflected = Size >= Alignment;
+
+		if (!Gap.bUnreflected)
+		{
+			OutReport.PaddingBytes += Size;
+		}
+	};
+
+	for (const FProperty* Property : Properties)
+	{
+		const int32 Offset = Property->GetOffset_ForInternal();
+		if (Offset > Cursor)
+		{
+			AddGap(Cursor, Offset - Cursor, FMath::Max(1, Property->GetMinAlignment()));
+		}
+
+		Cursor = FMath::Max(Cursor, Offset + Property->GetSize());
+		PreviousName = Property->GetName();
+	}
+
+	if (OutReport.PropertiesSize > Cursor)
+	{
+		AddGap(Cursor, OutReport.PropertiesSize - Cursor, OutReport.MinAlignment);
+	}
+}
+
+void FObjectProfilerLayoutAnalyzer::MeasureAllocation(const FObjectClassStats& Stats, FClassLayoutReport& OutReport)
+{
+	OutReport.AllocationSize = static_cast<int32>(FMemory::QuantizeSize(OutReport.PropertiesSize, OutReport.MinAlignment));
+
+	for (const FString& SamplePath : Stats.SampleObjectNames)
+	{
+		UObject* Sample = FindObject<UObject>(nullptr, *SamplePath);
+		if (!Sample || GUObjectAllocator.ResidesInPermanentPool(Sample))
+		{
+			continue;
+		}
+
+		SIZE_T AllocatedSize = 0;
+		if (FMemory::GetAllocSize(Sample, AllocatedSize) && AllocatedSize >= static_cast<SIZE_T>(OutReport.PropertiesSize))
+		{
+			OutReport.AllocationSize = static_cast<int32>(AllocatedSize);
+			OutReport.bAllocationMeasured = true;
+			break;
+		}
+	}
+
+	OutReport.BinWasteBytes = FMath::Max(0, OutReport.AllocationSize - OutReport.PropertiesSize);
+}
+
+void FObjectProfilerLayoutAnalyzer::SuggestOrdering(const UClass* Class, FClassLayoutReport& OutReport)
+{
+	const UClass* SuperClass = Class->GetSuperClass();
+	const int32 BlockStart = SuperClass ? SuperClass->GetPropertiesSize() : 0;
+
+	for (const FClassLayoutGap& Gap : OutReport.Gaps)
+	{
+		if (Gap.bUnreflected && Gap.Offset >= BlockStart)
+		{
+			return;
+		}
+	}
+
+	struct FLayoutSlot
+	{
+		FString Name;
+		int32 Offset = 0;
+		int32 Size = 0;
+		int32 Alignment = 1;
+	};
+
+	TArray<FLayoutSlot> Slots;
+	for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		const FProperty* Property = *It;
+		const int32 Offset = Property->GetOffset_ForInternal();
+
+		FLayoutSlot* SharedSlot = Slots.FindByPredicate([Offset](const FLayoutSlot& Slot) { return Slot.Offset == Offset; });
+		if (SharedSlot)
+		{
+			SharedSlot->Name += TEXT("|") + Property->GetName();
+			SharedSlot->Size = FMath::Max(SharedSlot->Size, Property->GetSize());
+			continue;
+		}
+
+		FLayoutSlot& Slot = Slots.AddDefaulted_GetRef();
+		Slot.Name = Property->GetName();
+		Slot.Offset = Offset;
+		Slot.Size = Property->GetSize();
+		Slot.Alignment = FMath::Max(1, Property->GetMinAlignment());
+	}
+
+	if (Slots.Num() < 2)
+	{
+		return;
+	}
+
+	int32 CurrentEnd = BlockStart;
+	for (const FLayoutSlot& Slot : Slots)
+	{
+		CurrentEnd = FMath::Max(CurrentEnd, Slot.Offset + Slot.Size);
+	}
+
+	Slots.StableSort([](const FLayoutSlot& A, const FLayoutSlot& B)
+	{
+		return A.Alignment != B.Alignment ? A.Alignment > B.Alignment : A.Size > B.Size;
+	});
+
+	int32 PackedEnd = BlockStart;
+	for (const FLayoutSlot& Slot : Slots)
+	{
+		PackedEnd = Align(PackedEnd, Slot.Alignment) + Slot.Size;
+	}
+
+	const int32 Saving = Align(CurrentEnd, OutReport.MinAlignment) - Align(PackedEnd, OutReport.MinAlignment);
+	if (Saving <= 0)
+	{
+		return;
+	}
+
+	OutReport.ReorderSavingBytes = Saving;
+	for (const FLayoutSlot& Slot : Slots)
+	{
+		OutReport.SuggestedOrder.Add(Slot.Name);
+	}
+}
\ No newline at end of file
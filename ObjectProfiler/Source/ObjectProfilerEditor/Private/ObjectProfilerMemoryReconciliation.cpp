@@ -0,0 +1,100 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerMemoryReconciliation.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/LowLevelMemTracker.h"
+
+TArray<FMemoryReconciliationSample> FObjectProfilerMemoryReconciliation::Samples;
+
+void FObjectProfilerMemoryReconciliation::RecordSample(const TArray<TSharedPtr<FObjectClassStats>>& Stats)
+{
+	FMemoryReconciliationSample Sample;
+
+	for (const TSharedPtr<FObjectClassStats>& ClassStats : Stats)
+	{
+		if (ClassStats.IsValid() && ClassStats->bSizeAvailable)
+		{
+			Sample.AttributedBytes += ClassStats->TotalSizeBytes;
+			Sample.AttributedVideoBytes += ClassStats->SizeBreakdown.VideoBytes;
+			Sample.CategoryBytes.FindOrAdd(ClassStats->Category) += ClassStats->TotalSizeBytes;
+		}
+	}
+
+	AddSample(MoveTemp(Sample));
+}
+
+void FObjectProfilerMemoryReconciliation::RecordSample(const FObjectSnapshot& Snapshot)
+{
+	FMemoryReconciliationSample Sample;
+	Sample.AttributedBytes = Snapshot.TotalSize;
+	Sample.AttributedVideoBytes = Snapshot.VideoSize;
+	AddSample(MoveTemp(Sample));
+}
+
+void FObjectProfilerMemoryReconciliation::ClearSamples()
+{
+	Samples.Empty();
+}
+
+const TArray<FMemoryReconciliationSample>& FObjectProfilerMemoryReconciliation::GetSamples()
+{
+	return Samples;
+}
+
+const FMemoryReconciliationSample* FObjectProfilerMemoryReconciliation::GetLatestCategorySample()
+{
+	for (int32 Index = Samples.Num() - 1; Index >= 0; --Index)
+	{
+		if (Samples[Index].CategoryBytes.Num() > 0)
+		{
+			return &Samples[Index];
+		}
+	}
+	return nullptr;
+}
+
+bool FObjectProfilerMemoryReconciliation::IsLLMAvailable()
+{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	return FLowLevelMemTracker::IsEnabled();
+#else
+	return false;
+#endif
+}
+
+void FObjectProfilerMemoryReconciliation::CaptureProcessTotals(FMemoryReconciliationSample& Sample)
+{
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	Sample.Timestamp = FPlatformTime::Seconds();
+	Sample.ProcessPhysicalBytes = static_cast<int64>(MemoryStats.UsedPhysical);
+	Sample.ProcessVirtualBytes = static_cast<int64>(MemoryStats.UsedVirtual);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	if (!IsLLMAvailable())
+	{
+		return;
+	}
+
+	FLowLevelMemTracker& Tracker = FLowLevelMemTracker::Get();
+	Sample.bHasLLM = true;
+	Sample.LLMTrackedBytes = Tracker.GetTagAmountForTracker(ELLMTracker::Default, ELLMTag::TrackedTotal);
+	Sample.LLMUObjectBytes = Tracker.GetTagAmountForTracker(ELLMTracker::Default, ELLMTag::UObject);
+	Sample.LLMCategoryBytes.Add(EObjectCategory::Texture, Tracker.GetTagAmountForTracker(ELLMTracker::Default, ELLMTag::Textures));
+	Sample.LLMCategoryBytes.Add(EObjectCategory::Mesh, Tracker.GetTagAmountForTracker(ELLMTracker::Default, ELLMTag::StaticMesh));
+	Sample.LLMCategoryBytes.Add(EObjectCategory::Material, Tracker.GetTagAmountForTracker(ELLMTracker::Default, ELLMTag::Materials));
+	Sample.LLMCategoryBytes.Add(EObjectCategory::Audio, Tracker.GetTagAmountForTracker(ELLMTracker::Default, ELLMTag::Audio));
+	Sample.LLMCategoryBytes.Add(EObjectCategory::Animation, Tracker.GetTagAmountForTracker(ELLMTracker::Default, ELLMTag::Animation));
+#endif
+}
+
+void FObjectProfilerMemoryReconciliation::AddSample(FMemoryReconciliationSample&& Sample)
+{
+	CaptureProcessTotals(Sample);
+
+	if (Samples.Num() >= MaxSamples)
+	{
+		Samples.RemoveAt(0);
+	}
+
+	Samples.Add(MoveTemp(Sample));
+}
\ No newline at end of file
@@ -0,0 +1,260 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerPropertyBreakdown.h"
+#include "ObjectProfilerCore.h"
+#include "UObject/UnrealType.h"
+#include "UObject/TextProperty.h"
+
+TMap<FObjectKey, TSharedPtr<FPropertyMemoryNode>> FObjectProfilerPropertyBreakdown::Cache;
+
+TSharedPtr<FPropertyMemoryNode> FObjectProfilerPropertyBreakdown::GetBreakdown(UObject* Object, bool bForceRebuild)
+{
+	if (!IsValid(Object))
+	{
+		return nullptr;
+	}
+
+	const FObjectKey Key(Object);
+	if (!bForceRebuild)
+	{
+		if (const TSharedPtr<FPropertyMemoryNode>* Cached = Cache.Find(Key))
+		{
+			return *Cached;
+		}
+	}
+
+	if (Cache.Num() >= MaxCachedObjects)
+	{
+		Cache.Reset();
+	}
+
+	FBuildContext Context;
+	Context.Root = Object;
+
+	TSharedPtr<FPropertyMemoryNode> Root = BuildObjectNode(Object, 0, Context);
+
+	const int64 ResourceBytes = FObjectProfilerCore::GetObjectSize(Object);
+	if (ResourceBytes > Root->TotalBytes)
+	{
+		TSharedPtr<FPropertyMemoryNode> Native = MakeShared<FPropertyMemoryNode>();
+		Native->Name = TEXT("(native, unreflected)");
+		Native->TypeName = TEXT("GetResourceSizeBytes remainder");
+		Native->TotalBytes = ResourceBytes - Root->TotalBytes;
+		Root->Children.Add(Native);
+		Root->TotalBytes = ResourceBytes;
+	}
+
+	TrimChildren(*Root);
+	Cache.Add(Key, Root);
+	return Root;
+}
+
+void FObjectProfilerPropertyBreakdown::ClearCache()
+{
+	Cache.Empty();
+}
+
+TSharedPtr<FPropertyMemoryNode> FObjectProfilerPropertyBreakdown::BuildObjectNode(UObject* Object, int32 Depth, FBuildContext& Context)
+{
+	Context.VisitedObjects.Add(Object);
+
+	const UClass* Class = Object->GetClass();
+
+	TSharedPtr<FPropertyMemoryNode> Node = MakeShared<FPropertyMemoryNode>();
+	Node->Name = Object->GetName();
+	Node->TypeName = Class->GetName();
+	Node->InlineBytes = Class->GetStructureSize();
+	Node->TotalBytes = Node->InlineBytes;
+
+	AddStructChildren(Class, Object, Depth, Context, *Node);
+	return Node;
+}
+
+TSharedPtr<FPropertyMemoryNode> FObjectProfilerPropertyBreakdown::BuildValueNode(const FProperty* Property, const void* ValuePtr, const FString& Name, int32 Depth, FBuildContext& Context)
+{
+	TSharedPtr<FPropertyMemoryNode> Node = MakeShared<FPropertyMemoryNode>();
+	Node->Name = Name;
+	Node->TypeName = Property->GetCPPType();
+	Node->InlineBytes = GetValueSize(Property);
+	Node->TotalBytes = Node->InlineBytes;
+
+	const bool bRecurse = Depth < MaxDepth;
+
+	if (Property->IsA<FStrProperty>())
+	{
+		Node->TotalBytes += static_cast<const FString*>(ValuePtr)->GetAllocatedSize();
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+		const FScriptArray* Array = static_cast<const FScriptArray*>(ValuePtr);
+		Node->TotalBytes += static_cast<int64>(Array->Num() + Array->GetSlack()) * ArrayProperty->Inner->GetSize();
+
+		if (bRecurse && !ArrayProperty->Inner->HasAnyPropertyFlags(CPF_IsPlainOldData))
+		{
+			for (int32 Index = 0; Index < Helper.Num(); ++Index)
+			{
+				AddElementChild(ArrayProperty->Inner, Helper.GetRawPtr(Index), FString::Printf(TEXT("[%d]"), Index), Depth + 1, Context, *Node);
+			}
+		}
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Helper(SetProperty, ValuePtr);
+		Node->TotalBytes += static_cast<int64>(FObjectProfilerCore::GetSparseCapacity(ValuePtr)) * SetProperty->SetLayout.Size + FObjectProfilerCore::GetHashBytes(Helper.GetMaxIndex());
+
+		if (bRecurse && !SetProperty->ElementProp->HasAnyPropertyFlags(CPF_IsPlainOldData))
+		{
+			for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+			{
+				if (Helper.IsValidIndex(Index))
+				{
+					const void* ElementPtr = Helper.GetElementPtr(Index);
+					AddElementChild(SetProperty->ElementProp, ElementPtr, DescribeKey(SetProperty->ElementProp, ElementPtr), Depth + 1, Context, *Node);
+				}
+			}
+		}
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper Helper(MapProperty, ValuePtr);
+		Node->TotalBytes += static_cast<int64>(FObjectProfilerCore::GetSparseCapacity(ValuePtr)) * MapProperty->MapLayout.SetLayout.Size + FObjectProfilerCore::GetHashBytes(Helper.GetMaxIndex());
+
+		if (bRecurse)
+		{
+			for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+			{
+				if (!Helper.IsValidIndex(Index))
+				{
+					continue;
+				}
+
+				const void* KeyPtr = Helper.GetKeyPtr(Index);
+				TSharedPtr<FPropertyMemoryNode> KeyNode = BuildValueNode(MapProperty->KeyProp, KeyPtr, FString(), Depth + 1, Context);
+				TSharedPtr<FPropertyMemoryNode> PairNode = BuildValueNode(MapProperty->ValueProp, Helper.GetValuePtr(Index), DescribeKey(MapProperty->KeyProp, KeyPtr), Depth + 1, Context);
+				PairNode->InlineBytes += KeyNode->InlineBytes;
+				PairNode->TotalBytes += KeyNode->TotalBytes;
+
+				if (PairNode->GetHeapBytes() > 0)
+				{
+					Node->TotalBytes += PairNode->GetHeapBytes();
+					Node->Children.Add(PairNode);
+				}
+			}
+		}
+	}
+	else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		if (bRecurse)
+		{
+			AddStructChildren(StructProperty->Struct, ValuePtr, Depth + 1, Context, *Node);
+		}
+	}
+	else if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+	{
+		UObject* Referenced = ObjectProperty->GetObjectPropertyValue(ValuePtr);
+		if (bRecurse && Referenced && Referenced->IsIn(Context.Root) && !Context.VisitedObjects.Contains(Referenced))
+		{
+			TSharedPtr<FPropertyMemoryNode> SubobjectNode = BuildObjectNode(Referenced, Depth + 1, Context);
+			Node->TypeName = FString::Printf(TEXT("%s (owned)"), *Node->TypeName);
+			Node->TotalBytes += SubobjectNode->TotalBytes;
+			Node->Children = MoveTemp(SubobjectNode->Children);
+		}
+	}
+
+	TrimChildren(*Node);
+	return Node;
+}
+
+void FObjectProfilerPropertyBreakdown::AddStructChildren(const UStruct* Struct, const void* Container, int32 Depth, FBuildContext& Context, FPropertyMemoryNode& Parent)
+{
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		const FProperty* Property = *It;
+		const int32 ValueSize = GetValueSize(Property);
+		const int32 ElementCount = ValueSize > 0 ? Property->GetSize() / ValueSize : 0;
+		const uint8* BasePtr = static_cast<const uint8*>(Container) + Property->GetOffset_ForInternal();
+
+		for (int32 ElementIndex = 0; ElementIndex < ElementCount; ++ElementIndex)
+		{
+			const FString Name = ElementCount > 1 ? FString::Printf(TEXT("%s[%d]"), *Property->GetName(), ElementIndex) : Property->GetName();
+			TSharedPtr<FPropertyMemoryNode> Child = BuildValueNode(Property, BasePtr + ElementIndex * ValueSize, Name, Depth, Context);
+			Parent.TotalBytes += Child->GetHeapBytes();
+			Parent.Children.Add(Child);
+		}
+	}
+}
+
+void FObjectProfilerPropertyBreakdown::AddElementChild(const FProperty* Property, const void* ValuePtr, const FString& Name, int32 Depth, FBuildContext& Context, FPropertyMemoryNode& Parent)
+{
+	TSharedPtr<FPropertyMemoryNode> Child = BuildValueNode(Property, ValuePtr, Name, Depth, Context);
+	if (Child->GetHeapBytes() > 0)
+	{
+		Parent.TotalBytes += Child->GetHeapBytes();
+		Parent.Children.Add(Child);
+	}
+}
+
+int32 FObjectProfilerPropertyBreakdown::GetValueSize(const FProperty* Property)
+{
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		return StructProperty->Struct->GetStructureSize();
+	}
+	if (Property->IsA<FStrProperty>())
+	{
+		return sizeof(FString);
+	}
+	if (Property->IsA<FTextProperty>())
+	{
+		return sizeof(FText);
+	}
+	if (Property->IsA<FArrayProperty>())
+	{
+		return sizeof(FScriptArray);
+	}
+	if (Property->IsA<FSetProperty>())
+	{
+		return sizeof(FScriptSet);
+	}
+	if (Property->IsA<FMapProperty>())
+	{
+		return sizeof(FScriptMap);
+	}
+	if (Property->IsA<FObjectProperty>())
+	{
+		return sizeof(FObjectPtr);
+	}
+	return Property->GetSize();
+}
+
+FString FObjectProfilerPropertyBreakdown::DescribeKey(const FProperty* KeyProperty, const void* KeyPtr)
+{
+	FString KeyText;
+	KeyProperty->ExportTextItem_Direct(KeyText, KeyPtr, nullptr, nullptr, PPF_None);
+	return FString::Printf(TEXT("[%s]"), *KeyText.Left(MaxKeyLength));
+}
+
+void FObjectProfilerPropertyBreakdown::TrimChildren(FPropertyMemoryNode& Node)
+{
+	Node.Children.Sort([](const TSharedPtr<FPropertyMemoryNode>& A, const TSharedPtr<FPropertyMemoryNode>& B)
+	{
+		return A->TotalBytes > B->TotalBytes;
+	});
+
+	if (Node.Children.Num() <= MaxChildren)
+	{
+		return;
+	}
+
+	TSharedPtr<FPropertyMemoryNode> Remainder = MakeShared<FPropertyMemoryNode>();
+	for (int32 Index = MaxChildren; Index < Node.Children.Num(); ++Index)
+	{
+		Remainder->InlineBytes += Node.Children[Index]->InlineBytes;
+		Remainder->TotalBytes += Node.Children[Index]->TotalBytes;
+	}
+	Remainder->Name = FString::Printf(TEXT("(%d more)"), Node.Children.Num() - MaxChildren);
+
+	Node.Children.SetNum(MaxChildren);
+	Node.Children.Add(Remainder);
+}
\ No newline at end of file
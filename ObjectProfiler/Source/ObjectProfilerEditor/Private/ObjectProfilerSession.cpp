@@ -0,0 +1,705 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerSession.h"
+#include "ObjectProfilerMemoryReconciliation.h"
+#include "ObjectProfilerGovernor.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Dom/JsonObject.h"
+
+FObjectProfilerSession::FObjectProfilerSession(const FString& InName, const FProfilerCollectionScope& InScope)
+	: Name(InName)
+	, Scope(InScope)
+	, ScopeHistoryKey(MakeHistoryKey(InScope))
+{
+}
+
+FObjectProfilerSession::~FObjectProfilerSession()
+{
+	StopRealTimeMonitoring();
+}
+
+void FObjectProfilerSession::SetScope(const FProfilerCollectionScope& InScope)
+{
+	const FString HistoryKey = MakeHistoryKey(InScope);
+	
+	FScopeLock Lock(&HistoryLock);
+	Scope = InScope;
+	ScopeHistoryKey = HistoryKey;
+	PreviousStats.Empty();
+	ForeignScopeStats.Remove(ScopeHistoryKey);
+}
+
+void FObjectProfilerSession::Refresh(int32 MaxSamplesPerClass, FOnObjectStatsCollected OnComplete)
+{
+	FName WorldLabel;
+	if (!FObjectProfilerCore::GetScopeWorldLabel(Scope, WorldLabel))
+	{
+		OnComplete.ExecuteIfBound(CollectNow(MaxSamplesPerClass));
+		return;
+	}
+	
+	FHeapWalkRequest Request;
+	Request.Needs = EHeapWalkNeeds::Counts | EHeapWalkNeeds::Sizes | EHeapWalkNeeds::Samples;
+	Request.MaxSamplesPerClass = MaxSamplesPerClass;
+	
+	FObjectProfilerCore::RequestHeapWalk(Request, FOnHeapWalkComplete::CreateSPLambda(this, [this, OnComplete](const FHeapWalkResult& WalkResult)
+	{
+		if (WalkResult.bCancelled)
+		{
+			UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Refresh of session '%s' dropped, heap walk was cancelled"), *Name);
+			return;
+		}
+		
+		TArray<TSharedPtr<FObjectClassStats>> Result = CopyScopedStats(WalkResult.ClassStats);
+		ApplyHistory(Result, true);
+		FObjectProfilerCore::ComputeHierarchyRollups(Result);
+		
+		if (Scope.IsEmpty())
+		{
+			FObjectProfilerMemoryReconciliation::RecordSample(Result);
+		}
+		OnComplete.ExecuteIfBound(Result);
+	}));
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerSession::CollectNow(int32 MaxSamplesPerClass, bool bShowProgress)
+{
+	TArray<TSharedPtr<FObjectClassStats>> Result;
+	
+	FName WorldLabel;
+	if (FObjectProfilerCore::GetScopeWorldLabel(Scope, WorldLabel))
+	{
+		FHeapWalkRequest Request;
+		Request.Needs = EHeapWalkNeeds::Counts | EHeapWalkNeeds::Sizes | EHeapWalkNeeds::Samples;
+		Request.MaxSamplesPerClass = MaxSamplesPerClass;
+		Request.bShowProgress = bShowProgress;
+		
+		const FHeapWalkResult WalkResult = FObjectProfilerCore::WalkHeap(Request);
+		if (WalkResult.bCancelled)
+		{
+			return Result;
+		}
+		Result = CopyScopedStats(WalkResult.ClassStats);
+	}
+	else
+	{
+		Result = FObjectProfilerCore::CollectScopedStats(Scope, MaxSamplesPerClass);
+	}
+	
+	ApplyHistory(Result, true);
+	FObjectProfilerCore::ComputeHierarchyRollups(Result);
+	
+	if (Scope.IsEmpty())
+	{
+		FObjectProfilerMemoryReconciliation::RecordSample(Result);
+	}
+	return Result;
+}
+
+void FObjectProfilerSession::CollectAsync(int32 MaxSamplesPerClass, FOnObjectStatsCollected OnComplete, FOnCollectionProgress OnProgress, FOnPartialResults OnPartialResults)
+{
+	FObjectProfilerCore::CollectObjectStatsAsync(AsShared(), Scope, MaxSamplesPerClass, OnComplete, OnProgress, OnPartialResults);
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerSession::CopyScopedStats(const TMap<UClass*, TSharedPtr<FObjectClassStats>>& ClassStats) const
+{
+	TArray<TSharedPtr<FObjectClassStats>> Result;
+	Result.Reserve(ClassStats.Num());
+	
+	for (const auto& Pair : ClassStats)
+	{
+		if (Pair.Value->InstanceCount > 0)
+		{
+			Result.Add(MakeShared<FObjectClassStats>(*Pair.Value));
+		}
+	}
+	
+	FName WorldLabel;
+	if (FObjectProfilerCore::GetScopeWorldLabel(Scope, WorldLabel) && !WorldLabel.IsNone())
+	{
+		FObjectProfilerCore::ProjectStatsToWorld(Result, WorldLabel);
+	}
+	
+	return Result;
+}
+
+FString FObjectProfilerSession::MakeHistoryKey(const FProfilerCollectionScope& InScope)
+{
+	if (InScope.IsEmpty())
+	{
+		return FString();
+	}
+	
+	FString Key = FString::Join(InScope.PackagePrefixes, TEXT(";"));
+	Key += TEXT("|");
+	Key += InScope.World.IsValid() ? InScope.World->GetPathName() : FString();
+	Key += TEXT("|");
+	Key += InScope.Outer.IsValid() ? InScope.Outer->GetPathName() : FString();
+	return Key;
+}
+
+FString FObjectProfilerSession::GetScopeHistoryKey() const
+{
+	FScopeLock Lock(&HistoryLock);
+	return ScopeHistoryKey;
+}
+
+TMap<FString, TSharedPtr<FObjectClassStats>>& FObjectProfilerSession::FindOrAddHistory(const FString& HistoryKey)
+{
+	if (HistoryKey == ScopeHistoryKey)
+	{
+		return PreviousStats;
+	}
+	
+	if (!ForeignScopeStats.Contains(HistoryKey) && ForeignScopeStats.Num() >= MaxForeignScopeHistories)
+	{
+		ForeignScopeStats.Reset();
+	}
+	return ForeignScopeStats.FindOrAdd(HistoryKey);
+}
+
+const TMap<FString, TSharedPtr<FObjectClassStats>>* FObjectProfilerSession::FindHistory(const FString& HistoryKey) const
+{
+	return HistoryKey == ScopeHistoryKey ? &PreviousStats : ForeignScopeStats.Find(HistoryKey);
+}
+
+void FObjectProfilerSession::ApplyHistory(TArray<TSharedPtr<FObjectClassStats>>& InStats, bool bSizesMeasured)
+{
+	ApplyHistoryForKey(InStats, bSizesMeasured, GetScopeHistoryKey());
+}
+
+void FObjectProfilerSession::ApplyHistory(TArray<TSharedPtr<FObjectClassStats>>& InStats, bool bSizesMeasured, const FProfilerCollectionScope& HistoryScope)
+{
+	ApplyHistoryForKey(InStats, bSizesMeasured, MakeHistoryKey(HistoryScope));
+}
+
+void FObjectProfilerSession::ApplyHistoryForKey(TArray<TSharedPtr<FObjectClassStats>>& InStats, bool bSizesMeasured, const FString& HistoryKey)
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	
+	FScopeLock Lock(&HistoryLock);
+	
+	const EResourceSizeMode::Type SizeMode = FObjectProfilerCore::GetResourceSizeMode();
+	if (SizeMode != HistorySizeMode)
+	{
+		PreviousStats.Empty();
+		ForeignScopeStats.Empty();
+		HistorySizeMode = SizeMode;
+	}
+	
+	TMap<FString, TSharedPtr<FObjectClassStats>>& History = FindOrAddHistory(HistoryKey);
+	
+	for (TSharedPtr<FObjectClassStats>& Stats : InStats)
+	{
+		if (bSizesMeasured && Stats->InstanceCount > 0 && Stats->bSizeAvailable && Stats->TotalSizeBytes > 0)
+		{
+			Stats->AverageSizeBytes = Stats->TotalSizeBytes / Stats->InstanceCount;
+		}
+		
+		if (const TSharedPtr<FObjectClassStats>* PrevStats = History.Find(Stats->ClassName))
+		{
+			Stats->DeltaCount = Stats->InstanceCount - (*PrevStats)->InstanceCount;
+			
+			if (bSizesMeasured)
+			{
+				Stats->DeltaSizeBytes = Stats->TotalSizeBytes - (*PrevStats)->TotalSizeBytes;
+				Stats->DeltaSizeBreakdown = Stats->SizeBreakdown - (*PrevStats)->SizeBreakdown;
+			}
+			else
+			{
+				Stats->TotalSizeBytes = (*PrevStats)->TotalSizeBytes;
+				Stats->AverageSizeBytes = (*PrevStats)->AverageSizeBytes;
+				Stats->bSizeAvailable = (*PrevStats)->bSizeAvailable;
+				Stats->SizeDistribution = (*PrevStats)->SizeDistribution;
+				Stats->SizeBreakdown = (*PrevStats)->SizeBreakdown;
+				Stats->DeltaSizeBreakdown = (*PrevStats)->DeltaSizeBreakdown;
+			}
+			
+			if (Stats->FlagCensus.IsEmpty())
+			{
+				Stats->FlagCensus = (*PrevStats)->FlagCensus;
+			}
+			
+			Stats->UpdateWorldDeltas(**PrevStats);
+			Stats->History = (*PrevStats)->History;
+		}
+		
+		Stats->AddHistoryPoint(Stats->InstanceCount, Stats->TotalSizeBytes, CurrentTime, bSizesMeasured ? Stats->FlagCensus.GetRetainedCount() : INDEX_NONE);
+		Stats->UpdateLeakDetection(LeakDetectionThreshold);
+		Stats->CalculateRateOfChange();
+		
+		History.Add(Stats->ClassName, Stats);
+	}
+}
+
+TSharedPtr<FObjectClassStats> FObjectProfilerSession::FindPreviousStats(const FString& ClassName) const
+{
+	FScopeLock Lock(&HistoryLock);
+	return PreviousStats.FindRef(ClassName);
+}
+
+TSharedPtr<FObjectClassStats> FObjectProfilerSession::FindPreviousStats(const FString& ClassName, const FProfilerCollectionScope& HistoryScope) const
+{
+	const FString HistoryKey = MakeHistoryKey(HistoryScope);
+	
+	FScopeLock Lock(&HistoryLock);
+	const TMap<FString, TSharedPtr<FObjectClassStats>>* History = FindHistory(HistoryKey);
+	return History ? History->FindRef(ClassName) : TSharedPtr<FObjectClassStats>();
+}
+
+void FObjectProfilerSession::TakeSnapshot(const FString& SnapshotName)
+{
+	TakeScopedSnapshot(SnapshotName, Scope);
+}
+
+void FObjectProfilerSession::RequestSnapshot(const FString& SnapshotName)
+{
+	RequestScopedSnapshot(SnapshotName, Scope);
+}
+
+void FObjectProfilerSession::TakeScopedSnapshot(const FString& SnapshotName, const FProfilerCollectionScope& SnapshotScope)
+{
+	FObjectSnapshot Snapshot;
+	
+	FName WorldLabel;
+	if (FObjectProfilerCore::GetScopeWorldLabel(SnapshotScope, WorldLabel))
+	{
+		FHeapWalkRequest Request;
+		Request.Needs = EHeapWalkNeeds::Counts | EHeapWalkNeeds::Sizes;
+		
+		const FHeapWalkResult WalkResult = FObjectProfilerCore::WalkHeap(Request);
+		if (WalkResult.bCancelled)
+		{
+			UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Snapshot in session '%s' dropped, heap walk was cancelled"), *Name);
+			return;
+		}
+		FObjectProfilerCore::FillSnapshotFromWalk(Snapshot, WalkResult, WorldLabel);
+	}
+	else
+	{
+		FObjectProfilerCore::FillSnapshotFromScope(Snapshot, SnapshotScope, true);
+	}
+	
+	RecordSnapshot(Snapshot, SnapshotName);
+	
+	if (SnapshotScope.IsEmpty())
+	{
+		FObjectProfilerMemoryReconciliation::RecordSample(Snapshot);
+	}
+}
+
+void FObjectProfilerSession::RequestScopedSnapshot(const FString& SnapshotName, const FProfilerCollectionScope& SnapshotScope)
+{
+	FName WorldLabel;
+	if (!FObjectProfilerCore::GetScopeWorldLabel(SnapshotScope, WorldLabel))
+	{
+		TakeScopedSnapshot(SnapshotName, SnapshotScope);
+		return;
+	}
+	
+	FHeapWalkRequest Request;
+	Request.Needs = EHeapWalkNeeds::Counts | EHeapWalkNeeds::Sizes;
+	
+	FObjectProfilerCore::RequestHeapWalk(Request, FOnHeapWalkComplete::CreateSPLambda(this, [this, SnapshotName, WorldLabel, bUnscoped = SnapshotScope.IsEmpty()](const FHeapWalkResult& WalkResult)
+	{
+		if (WalkResult.bCancelled)
+		{
+			UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Snapshot in session '%s' dropped, heap walk was cancelled"), *Name);
+			return;
+		}
+		
+		FObjectSnapshot Snapshot;
+		FObjectProfilerCore::FillSnapshotFromWalk(Snapshot, WalkResult, WorldLabel);
+		RecordSnapshot(Snapshot, SnapshotName);
+		
+		if (bUnscoped)
+		{
+			FObjectProfilerMemoryReconciliation::RecordSample(Snapshot);
+		}
+	}));
+}
+
+void FObjectProfilerSession::RecordSnapshot(FObjectSnapshot& Snapshot, const FString& SnapshotName)
+{
+	Snapshot.Name = SnapshotName.IsEmpty() 
+		? FString::Printf(TEXT("Snapshot_%d"), SnapshotHistory.Num() + 1) 
+		: SnapshotName;
+	Snapshot.Timestamp = FDateTime::Now();
+
+	if (SnapshotHistory.Num() >= MaxSnapshotHistory)
+	{
+		SnapshotHistory.RemoveAt(0);
+	}
+	
+	SnapshotHistory.Add(Snapshot);
+	
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Snapshot '%s' taken in session '%s' with %d unique classes, %d total objects"), 
+		*Snapshot.Name, *Name, Snapshot.ClassCounts.Num(), Snapshot.TotalObjects);
+	
+	SnapshotTakenDelegate.Broadcast(Snapshot);
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerSession::GetDeltaSinceSnapshot(int32 SnapshotIndex)
+{
+	if (SnapshotHistory.Num() == 0)
+	{
+		return TArray<TSharedPtr<FObjectClassStats>>();
+	}
+	
+	const int32 ActualIndex = SnapshotIndex < 0 ? SnapshotHistory.Num() - 1 : SnapshotIndex;
+	if (ActualIndex < 0 || ActualIndex >= SnapshotHistory.Num())
+	{
+		return TArray<TSharedPtr<FObjectClassStats>>();
+	}
+	
+	FObjectSnapshot Current;
+	
+	FName WorldLabel;
+	if (FObjectProfilerCore::GetScopeWorldLabel(Scope, WorldLabel))
+	{
+		FHeapWalkRequest Request;
+		Request.Needs = EHeapWalkNeeds::Counts;
+		
+		const FHeapWalkResult WalkResult = FObjectProfilerCore::WalkHeap(Request);
+		if (WalkResult.bCancelled)
+		{
+			return TArray<TSharedPtr<FObjectClassStats>>();
+		}
+		FObjectProfilerCore::FillSnapshotFromWalk(Current, WalkResult, WorldLabel);
+	}
+	else
+	{
+		FObjectProfilerCore::FillSnapshotFromScope(Current, Scope, false);
+	}
+	
+	return FObjectProfilerCore::DiffSnapshots(SnapshotHistory[ActualIndex], Current, false);
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerSession::CompareTwoSnapshots(int32 IndexA, int32 IndexB) const
+{
+	if (!SnapshotHistory.IsValidIndex(IndexA) || !SnapshotHistory.IsValidIndex(IndexB))
+	{
+		return TArray<TSharedPtr<FObjectClassStats>>();
+	}
+	
+	return FObjectProfilerCore::DiffSnapshots(SnapshotHistory[IndexA], SnapshotHistory[IndexB], true);
+}
+
+void FObjectProfilerSession::AddSnapshot(const FObjectSnapshot& Snapshot)
+{
+	if (SnapshotHistory.Num() >= MaxSnapshotHistory)
+	{
+		SnapshotHistory.RemoveAt(0);
+	}
+	
+	SnapshotHistory.Add(Snapshot);
+	SnapshotTakenDelegate.Broadcast(Snapshot);
+}
+
+void FObjectProfilerSession::ClearSnapshotHistory()
+{
+	SnapshotHistory.Empty();
+}
+
+void FObjectProfilerSession::DeleteSnapshot(int32 Index)
+{
+	if (Index >= 0 && Index < SnapshotHistory.Num())
+	{
+		SnapshotHistory.RemoveAt(Index);
+	}
+}
+
+bool FObjectProfilerSession::SaveSnapshotsToFile(const FString& FilePath) const
+{
+	TSharedPtr<FJsonObject> RootObject = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> SnapshotsArray;
+	
+	for (const FObjectSnapshot& Snapshot : SnapshotHistory)
+	{
+		TSharedPtr<FJsonObject> SnapshotObject = MakeShared<FJsonObject>();
+		SnapshotObject->SetStringField(TEXT("Name"), Snapshot.Name);
+		SnapshotObject->SetStringField(TEXT("Timestamp"), Snapshot.Timestamp.ToString());
+		SnapshotObject->SetNumberField(TEXT("TotalObjects"), Snapshot.TotalObjects);
+		SnapshotObject->SetNumberField(TEXT("TotalSize"), static_cast<double>(Snapshot.TotalSize));
+		SnapshotObject->SetNumberField(TEXT("VideoSize"), static_cast<double>(Snapshot.VideoSize));
+		
+		TSharedPtr<FJsonObject> ClassCountsObject = MakeShared<FJsonObject>();
+		for (const auto& [ClassName, Count] : Snapshot.ClassCounts)
+		{
+			ClassCountsObject->SetNumberField(ClassName, Count);
+		}
+		SnapshotObject->SetObjectField(TEXT("ClassCounts"), ClassCountsObject);
+		
+		TSharedPtr<FJsonObject> ClassSizesObject = MakeShared<FJsonObject>();
+		for (const auto& [ClassName, Size] : Snapshot.ClassSizes)
+		{
+			ClassSizesObject->SetNumberField(ClassName, static_cast<double>(Size));
+		}
+		SnapshotObject->SetObjectField(TEXT("ClassSizes"), ClassSizesObject);
+		
+		TArray<TSharedPtr<FJsonValue>> LargestObjectsArray;
+		for (const FLargestObjectEntry& Entry : Snapshot.LargestObjects)
+		{
+			TSharedPtr<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+			EntryObject->SetStringField(TEXT("Path"), Entry.ObjectPath);
+			EntryObject->SetStringField(TEXT("Class"), Entry.ClassName);
+			EntryObject->SetStringField(TEXT("Outer"), Entry.OuterName);
+			EntryObject->SetStringField(TEXT("World"), Entry.WorldLabel.ToString());
+			EntryObject->SetNumberField(TEXT("Size"), static_cast<double>(Entry.SizeBytes));
+			LargestObjectsArray.Add(MakeShared<FJsonValueObject>(EntryObject));
+		}
+		SnapshotObject->SetArrayField(TEXT("LargestObjects"), LargestObjectsArray);
+		
+		SnapshotsArray.Add(MakeShared<FJsonValueObject>(SnapshotObject));
+	}
+	
+	RootObject->SetArrayField(TEXT("Snapshots"), SnapshotsArray);
+	
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
+	
+	return FFileHelper::SaveStringToFile(OutputString, *FilePath);
+}
+
+bool FObjectProfilerSession::LoadSnapshotsFromFile(const FString& FilePath)
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		return false;
+	}
+	
+	TSharedPtr<FJsonObject> RootObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+	{
+		return false;
+	}
+	
+	const TArray<TSharedPtr<FJsonValue>>* SnapshotsArray;
+	if (!RootObject->TryGetArrayField(TEXT("Snapshots"), SnapshotsArray))
+	{
+		return false;
+	}
+	
+	for (const TSharedPtr<FJsonValue>& SnapshotValue : *SnapshotsArray)
+	{
+		const TSharedPtr<FJsonObject>* SnapshotObject;
+		if (!SnapshotValue->TryGetObject(SnapshotObject))
+		{
+			continue;
+		}
+		
+		FObjectSnapshot Snapshot;
+		Snapshot.Name = (*SnapshotObject)->GetStringField(TEXT("Name"));
+		
+		const FString TimestampStr = (*SnapshotObject)->GetStringField(TEXT("Timestamp"));
+		FDateTime::Parse(TimestampStr, Snapshot.Timestamp);
+		
+		Snapshot.TotalObjects = (*SnapshotObject)->GetIntegerField(TEXT("TotalObjects"));
+		Snapshot.TotalSize = static_cast<int64>((*SnapshotObject)->GetNumberField(TEXT("TotalSize")));
+		
+		double VideoSize = 0.0;
+		if ((*SnapshotObject)->TryGetNumberField(TEXT("VideoSize"), VideoSize))
+		{
+			Snapshot.VideoSize = static_cast<int64>(VideoSize);
+		}
+		
+		const TSharedPtr<FJsonObject>* ClassCountsObject;
+		if ((*SnapshotObject)->TryGetObjectField(TEXT("ClassCounts"), ClassCountsObject))
+		{
+			for (const auto& [Key, Value] : (*ClassCountsObject)->Values)
+			{
+				Snapshot.ClassCounts.Add(Key, static_cast<int32>(Value->AsNumber()));
+			}
+		}
+		
+		const TSharedPtr<FJsonObject>* ClassSizesObject;
+		if ((*SnapshotObject)->TryGetObjectField(TEXT("ClassSizes"), ClassSizesObject))
+		{
+			for (const auto& [Key, Value] : (*ClassSizesObject)->Values)
+			{
+				Snapshot.ClassSizes.Add(Key, static_cast<int64>(Value->AsNumber()));
+			}
+		}
+		
+		const TArray<TSharedPtr<FJsonValue>>* LargestObjectsArray;
+		if ((*SnapshotObject)->TryGetArrayField(TEXT("LargestObjects"), LargestObjectsArray))
+		{
+			for (const TSharedPtr<FJsonValue>& EntryValue : *LargestObjectsArray)
+			{
+				const TSharedPtr<FJsonObject>* EntryObject;
+				if (!EntryValue->TryGetObject(EntryObject))
+				{
+					continue;
+				}
+				
+				FLargestObjectEntry Entry;
+				Entry.ObjectPath = (*EntryObject)->GetStringField(TEXT("Path"));
+				Entry.ClassName = (*EntryObject)->GetStringField(TEXT("Class"));
+				Entry.OuterName = (*EntryObject)->GetStringField(TEXT("Outer"));
+				Entry.WorldLabel = FName(*(*EntryObject)->GetStringField(TEXT("World")));
+				Entry.SizeBytes = static_cast<int64>((*EntryObject)->GetNumberField(TEXT("Size")));
+				Snapshot.LargestObjects.Add(Entry);
+			}
+		}
+		
+		if (SnapshotHistory.Num() < MaxSnapshotHistory)
+		{
+			SnapshotHistory.Add(Snapshot);
+		}
+	}
+	
+	return true;
+}
+
+void FObjectProfilerSession::StartRealTimeMonitoring(float IntervalSeconds)
+{
+	if (bRealTimeMonitoringActive)
+	{
+		StopRealTimeMonitoring();
+	}
+	
+	FObjectProfilerCore::AcquireIncrementalTracking();
+	
+	RealTimeIntervalSeconds = FMath::Max(0.1f, IntervalSeconds);
+	bRealTimeMonitoringActive = true;
+	LastRealTimeUpdateTime = FPlatformTime::Seconds();
+	
+	RealTimeTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateSP(this, &FObjectProfilerSession::OnRealTimeTick),
+		RealTimeIntervalSeconds
+	);
+	
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Real-time monitoring started in session '%s' (interval: %.1fs)"), 
+		*Name, RealTimeIntervalSeconds);
+}
+
+void FObjectProfilerSession::StopRealTimeMonitoring()
+{
+	if (RealTimeTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RealTimeTickerHandle);
+		RealTimeTickerHandle.Reset();
+	}
+	
+	if (!bRealTimeMonitoringActive)
+	{
+		return;
+	}
+	
+	FObjectProfilerCore::ReleaseIncrementalTracking();
+	
+	bRealTimeMonitoringActive = false;
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Real-time monitoring stopped in session '%s'"), *Name);
+}
+
+void FObjectProfilerSession::SetRealTimeInterval(float IntervalSeconds)
+{
+	RealTimeIntervalSeconds = FMath::Max(0.1f, IntervalSeconds);
+	
+	if (bRealTimeMonitoringActive)
+	{
+		StopRealTimeMonitoring();
+		StartRealTimeMonitoring(RealTimeIntervalSeconds);
+	}
+}
+
+bool FObjectProfilerSession::OnRealTimeTick(float DeltaTime)
+{
+	if (!bRealTimeMonitoringActive)
+	{
+		return false;
+	}
+	
+	const double ThrottledInterval = RealTimeIntervalSeconds * FObjectProfilerGovernor::GetIntervalScale();
+	if (FPlatformTime::Seconds() - LastRealTimeUpdateTime + RealTimeIntervalSeconds * 0.5 < ThrottledInterval)
+	{
+		return true;
+	}
+	
+	FScopedProfilerCost Cost(EProfilerCostBucket::RealTime);
+	UpdateRealTimeStats();
+	return true;
+}
+
+void FObjectProfilerSession::UpdateRealTimeStats()
+{
+	if (bRealTimeBuildInFlight)
+	{
+		return;
+	}
+	
+	FName WorldLabel;
+	if (!FObjectProfilerCore::GetScopeWorldLabel(Scope, WorldLabel))
+	{
+		OnRealTimeStatsBuilt(UpdateFromIncrementalCounts());
+		return;
+	}
+	
+	TSharedPtr<FObjectProfilerCore::FIncrementalCountsSnapshot, ESPMode::ThreadSafe> Counts = MakeShared<FObjectProfilerCore::FIncrementalCountsSnapshot, ESPMode::ThreadSafe>();
+	FObjectProfilerCore::SnapshotIncrementalCounts(*Counts);
+	bRealTimeBuildInFlight = true;
+	
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Session = TSharedPtr<FObjectProfilerSession>(SharedThis(this)), Counts, WorldLabel, HistoryKey = GetScopeHistoryKey()]() mutable
+	{
+		TArray<TSharedPtr<FObjectClassStats>> Results = FObjectProfilerCore::BuildStatsFromCounts(*Counts);
+		if (!WorldLabel.IsNone())
+		{
+			FObjectProfilerCore::ProjectStatsToWorld(Results, WorldLabel);
+		}
+		Session->ApplyHistoryForKey(Results, false, HistoryKey);
+		FObjectProfilerCore::RollupIncrementalHierarchy(Results, *Counts);
+		
+		AsyncTask(ENamedThreads::GameThread, [Session = MoveTemp(Session), Results = MoveTemp(Results)]() mutable
+		{
+			Session->bRealTimeBuildInFlight = false;
+			Session->OnRealTimeStatsBuilt(MoveTemp(Results));
+		});
+	});
+}
+
+void FObjectProfilerSession::OnRealTimeStatsBuilt(TArray<TSharedPtr<FObjectClassStats>> Results)
+{
+	if (!bRealTimeMonitoringActive)
+	{
+		return;
+	}
+	
+	LastRealTimeUpdateTime = FPlatformTime::Seconds();
+	RealTimeUpdateDelegate.Broadcast(Results);
+}
+
+TArray<TSharedPtr<FObjectClassStats>> FObjectProfilerSession::UpdateFromIncrementalCounts()
+{
+	TArray<TSharedPtr<FObjectClassStats>> Results;
+	
+	FName WorldLabel;
+	if (FObjectProfilerCore::GetScopeWorldLabel(Scope, WorldLabel))
+	{
+		Results = FObjectProfilerCore::BuildIncrementalStats();
+		if (!WorldLabel.IsNone())
+		{
+			FObjectProfilerCore::ProjectStatsToWorld(Results, WorldLabel);
+		}
+		ApplyHistory(Results, false);
+	}
+	else
+	{
+		Results = FObjectProfilerCore::CollectScopedStats(Scope, 3);
+		ApplyHistory(Results, true);
+	}
+	
+	FObjectProfilerCore::ComputeHierarchyRollups(Results);
+	
+	return Results;
+}
+
+void FObjectProfilerSession::SetLeakDetectionThreshold(int32 ConsecutiveTicks)
+{
+	LeakDetectionThreshold = FMath::Max(2, ConsecutiveTicks);
+}
\ No newline at end of file
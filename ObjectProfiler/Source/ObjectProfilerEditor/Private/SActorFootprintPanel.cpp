@@ -0,0 +1,325 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "SActorFootprintPanel.h"
+#include "ObjectProfilerCore.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "ObjectProfiler"
+
+namespace ActorFootprintColumns
+{
+	static const FName Class("Class");
+	static const FName Actors("Actors");
+	static const FName Average("Average");
+	static const FName Total("Total");
+	static const FName Own("Own");
+	static const FName ObjectsPerActor("ObjectsPerActor");
+	static const FName Largest("Largest");
+}
+
+namespace FootprintLayoutConstants
+{
+	constexpr float SectionPadding = 8.0f;
+	constexpr float ControlPadding = 4.0f;
+}
+
+void SActorFootprintPanel::Construct(const FArguments& InArgs)
+{
+	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
+		+ SHeaderRow::Column(ActorFootprintColumns::Class)
+			.DefaultLabel(LOCTEXT("FootprintClassColumn", "Actor Class"))
+			.FillWidth(0.25f)
+			.SortMode(this, &SActorFootprintPanel::GetSortModeForColumn, ActorFootprintColumns::Class)
+			.OnSort(this, &SActorFootprintPanel::OnSortColumnHeader)
+		+ SHeaderRow::Column(ActorFootprintColumns::Actors)
+			.DefaultLabel(LOCTEXT("FootprintActorsColumn", "Actors"))
+			.FillWidth(0.08f)
+			.SortMode(this, &SActorFootprintPanel::GetSortModeForColumn, ActorFootprintColumns::Actors)
+			.OnSort(this, &SActorFootprintPanel::OnSortColumnHeader)
+		+ SHeaderRow::Column(ActorFootprintColumns::Average)
+			.DefaultLabel(LOCTEXT("FootprintAverageColumn", "Avg Footprint"))
+			.FillWidth(0.12f)
+			.SortMode(this, &SActorFootprintPanel::GetSortModeForColumn, ActorFootprintColumns::Average)
+			.OnSort(this, &SActorFootprintPanel::OnSortColumnHeader)
+		+ SHeaderRow::Column(ActorFootprintColumns::Total)
+			.DefaultLabel(LOCTEXT("FootprintTotalColumn", "Total Footprint"))
+			.FillWidth(0.12f)
+			.SortMode(this, &SActorFootprintPanel::GetSortModeForColumn, ActorFootprintColumns::Total)
+			.OnSort(this, &SActorFootprintPanel::OnSortColumnHeader)
+		+ SHeaderRow::Column(ActorFootprintColumns::Own)
+			.DefaultLabel(LOCTEXT("FootprintOwnColumn", "Actor Only"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(ActorFootprintColumns::ObjectsPerActor)
+			.DefaultLabel(LOCTEXT("FootprintObjectsColumn", "Objects/Actor"))
+			.FillWidth(0.1f)
+			.SortMode(this, &SActorFootprintPanel::GetSortModeForColumn, ActorFootprintColumns::ObjectsPerActor)
+			.OnSort(this, &SActorFootprintPanel::OnSortColumnHeader)
+		+ SHeaderRow::Column(ActorFootprintColumns::Largest)
+			.DefaultLabel(LOCTEXT("FootprintLargestColumn", "Largest Actor"))
+			.FillWidth(0.23f);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		// Toolbar
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(FootprintLayoutConstants::SectionPadding)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FootprintLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("FootprintRefresh", "Refresh"))
+				.ToolTipText(LOCTEXT("FootprintRefreshTooltip", "Walk the heap and charge every component and subobject to its owning actor"))
+				.OnClicked(this, &SActorFootprintPanel::OnRefreshClicked)
+				.IsEnabled_Lambda([this]() { return !bWalkInFlight; })
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(FootprintLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("FootprintFind", "Find"))
+				.ToolTipText(LOCTEXT("FootprintFindTooltip", "Select the largest actor of this class"))
+				.OnClicked(this, &SActorFootprintPanel::OnFindClicked)
+				.IsEnabled(this, &SActorFootprintPanel::HasSelection)
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			.Padding(FootprintLayoutConstants::SectionPadding, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SActorFootprintPanel::GetSummaryText)
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			]
+		]
+
+		// Footprint list
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(FootprintLayoutConstants::SectionPadding)
+		[
+			SAssignNew(EntryListView, SListView<TSharedPtr<FActorFootprintEntry>>)
+			.ListItemsSource(&EntryItems)
+			.OnGenerateRow(this, &SActorFootprintPanel::OnGenerateRowForList)
+			.OnMouseButtonDoubleClick(this, &SActorFootprintPanel::OnEntryDoubleClicked)
+			.SelectionMode(ESelectionMode::Single)
+			.HeaderRow(HeaderRow)
+		]
+	];
+
+	OnRefreshClicked();
+}
+
+TSharedRef<ITableRow> SActorFootprintPanel::OnGenerateRowForList(TSharedPtr<FActorFootprintEntry> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SActorFootprintRow, OwnerTable)
+		.Item(Item);
+}
+
+void SActorFootprintPanel::OnEntryDoubleClicked(TSharedPtr<FActorFootprintEntry> Item)
+{
+	if (Item.IsValid() && !FObjectProfilerCore::FocusObjectInEditor(Item->LargestActorPath))
+	{
+		StatusMessage = FText::Format(LOCTEXT("FootprintActorGone", "{0} is no longer loaded."), FText::FromString(Item->LargestActorPath));
+	}
+}
+
+void SActorFootprintPanel::OnSortColumnHeader(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type NewSortMode)
+{
+	if (CurrentSortColumn == ColumnId)
+	{
+		CurrentSortMode = (CurrentSortMode == EColumnSortMode::Ascending)
+			? EColumnSortMode::Descending
+			: EColumnSortMode::Ascending;
+	}
+	else
+	{
+		CurrentSortColumn = ColumnId;
+		CurrentSortMode = EColumnSortMode::Descending;
+	}
+
+	SortEntries();
+	EntryListView->RequestListRefresh();
+}
+
+EColumnSortMode::Type SActorFootprintPanel::GetSortModeForColumn(FName ColumnId) const
+{
+	return CurrentSortColumn == ColumnId ? CurrentSortMode : EColumnSortMode::None;
+}
+
+void SActorFootprintPanel::SortEntries()
+{
+	const bool bAscending = (CurrentSortMode == EColumnSortMode::Ascending);
+
+	EntryItems.Sort([this, bAscending](const TSharedPtr<FActorFootprintEntry>& A, const TSharedPtr<FActorFootprintEntry>& B)
+	{
+		int64 Result = 0;
+
+		if (CurrentSortColumn == ActorFootprintColumns::Class)
+		{
+			Result = A->ClassName.Compare(B->ClassName);
+		}
+		else if (CurrentSortColumn == ActorFootprintColumns::Actors)
+		{
+			Result = A->ActorCount - B->ActorCount;
+		}
+		else if (CurrentSortColumn == ActorFootprintColumns::Average)
+		{
+			Result = A->GetAverageSizeBytes() - B->GetAverageSizeBytes();
+		}
+		else if (CurrentSortColumn == ActorFootprintColumns::Total)
+		{
+			Result = A->TotalSizeBytes - B->TotalSizeBytes;
+		}
+		else if (CurrentSortColumn == ActorFootprintColumns::ObjectsPerActor)
+		{
+			Result = A->GetObjectsPerActor() > B->GetObjectsPerActor() ? 1 : (A->GetObjectsPerActor() < B->GetObjectsPerActor() ? -1 : 0);
+		}
+
+		return bAscending ? (Result < 0) : (Result > 0);
+	});
+}
+
+FReply SActorFootprintPanel::OnRefreshClicked()
+{
+	FHeapWalkRequest Request;
+	Request.Needs = EHeapWalkNeeds::ActorFootprint;
+
+	bWalkInFlight = true;
+	StatusMessage = LOCTEXT("FootprintWalking", "Charging subobjects to their actors...");
+	FObjectProfilerCore::RequestHeapWalk(Request, FOnHeapWalkComplete::CreateSP(this, &SActorFootprintPanel::OnHeapWalkComplete));
+
+	return FReply::Handled();
+}
+
+void SActorFootprintPanel::OnHeapWalkComplete(const FHeapWalkResult& WalkResult)
+{
+	bWalkInFlight = false;
+	StatusMessage = WalkResult.bCancelled ? LOCTEXT("FootprintCancelled", "Walk cancelled.") : FText::GetEmpty();
+
+	EntryItems.Reset(WalkResult.ActorFootprints.Num());
+	for (const FActorFootprintEntry& Entry : WalkResult.ActorFootprints)
+	{
+		EntryItems.Add(MakeShared<FActorFootprintEntry>(Entry));
+	}
+
+	SortEntries();
+	EntryListView->RequestListRefresh();
+}
+
+FReply SActorFootprintPanel::OnFindClicked()
+{
+	OnEntryDoubleClicked(GetSelectedEntry());
+	return FReply::Handled();
+}
+
+bool SActorFootprintPanel::HasSelection() const
+{
+	return GetSelectedEntry().IsValid();
+}
+
+TSharedPtr<FActorFootprintEntry> SActorFootprintPanel::GetSelectedEntry() const
+{
+	if (!EntryListView.IsValid())
+	{
+		return nullptr;
+	}
+
+	TArray<TSharedPtr<FActorFootprintEntry>> Selected = EntryListView->GetSelectedItems();
+	return Selected.Num() > 0 ? Selected[0] : nullptr;
+}
+
+FText SActorFootprintPanel::GetSummaryText() const
+{
+	if (!StatusMessage.IsEmpty())
+	{
+		return StatusMessage;
+	}
+
+	if (EntryItems.Num() == 0)
+	{
+		return LOCTEXT("FootprintNoData", "No actors found. Refresh after loading a level or starting PIE.");
+	}
+
+	int32 TotalActors = 0;
+	int64 TotalSize = 0;
+	for (const TSharedPtr<FActorFootprintEntry>& Entry : EntryItems)
+	{
+		TotalActors += Entry->ActorCount;
+		TotalSize += Entry->TotalSizeBytes;
+	}
+
+	return FText::Format(LOCTEXT("FootprintSummary", "{0} actors in {1} classes hold {2}"),
+		FText::AsNumber(TotalActors),
+		FText::AsNumber(EntryItems.Num()),
+		FText::FromString(FObjectProfilerCore::FormatBytes(TotalSize)));
+}
+
+void SActorFootprintRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Item = InArgs._Item;
+	SMultiColumnTableRow<TSharedPtr<FActorFootprintEntry>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SActorFootprintRow::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (!Item.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	FText CellText;
+	if (ColumnName == ActorFootprintColumns::Class)
+	{
+		CellText = FText::FromString(Item->ClassName);
+	}
+	else if (ColumnName == ActorFootprintColumns::Actors)
+	{
+		CellText = FText::AsNumber(Item->ActorCount);
+	}
+	else if (ColumnName == ActorFootprintColumns::Average)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->GetAverageSizeBytes()));
+	}
+	else if (ColumnName == ActorFootprintColumns::Total)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->TotalSizeBytes));
+	}
+	else if (ColumnName == ActorFootprintColumns::Own)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->OwnSizeBytes));
+	}
+	else if (ColumnName == ActorFootprintColumns::ObjectsPerActor)
+	{
+		CellText = FText::FromString(FString::Printf(TEXT("%.1f"), Item->GetObjectsPerActor()));
+	}
+	else if (ColumnName == ActorFootprintColumns::Largest)
+	{
+		CellText = FText::Format(LOCTEXT("FootprintLargestCell", "{0} ({1})"),
+			FText::FromString(Item->LargestActorPath),
+			FText::FromString(FObjectProfilerCore::FormatBytes(Item->MaxActorSizeBytes)));
+	}
+
+	return SNew(SBox)
+		.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		[
+			SNew(STextBlock)
+			.Text(CellText)
+			.ToolTipText(CellText)
+			.Margin(FMargin(4.0f, 2.0f))
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,268 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "SArchiveSizePanel.h"
+#include "ObjectProfilerCore.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Notifications/SProgressBar.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "ObjectProfiler"
+
+namespace ArchiveSizeColumns
+{
+	static const FName Class("Class");
+	static const FName Instances("Instances");
+	static const FName Measured("Measured");
+	static const FName ResourceSize("ResourceSize");
+	static const FName ArchiveSize("ArchiveSize");
+	static const FName Ratio("Ratio");
+}
+
+namespace ArchiveSizeLayoutConstants
+{
+	constexpr float SectionPadding = 8.0f;
+	constexpr float ControlPadding = 4.0f;
+	constexpr float ProgressWidth = 200.0f;
+}
+
+void SArchiveSizePanel::Construct(const FArguments& InArgs)
+{
+	Stats = InArgs._Stats;
+
+	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
+		+ SHeaderRow::Column(ArchiveSizeColumns::Class)
+			.DefaultLabel(LOCTEXT("ArchiveSizeClassColumn", "Class"))
+			.FillWidth(0.3f)
+		+ SHeaderRow::Column(ArchiveSizeColumns::Instances)
+			.DefaultLabel(LOCTEXT("ArchiveSizeInstancesColumn", "Instances"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(ArchiveSizeColumns::Measured)
+			.DefaultLabel(LOCTEXT("ArchiveSizeMeasuredColumn", "Measured"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(ArchiveSizeColumns::ResourceSize)
+			.DefaultLabel(LOCTEXT("ArchiveSizeResourceColumn", "Resource Size"))
+			.FillWidth(0.17f)
+		+ SHeaderRow::Column(ArchiveSizeColumns::ArchiveSize)
+			.DefaultLabel(LOCTEXT("ArchiveSizeArchiveColumn", "Archive Size"))
+			.FillWidth(0.17f)
+		+ SHeaderRow::Column(ArchiveSizeColumns::Ratio)
+			.DefaultLabel(LOCTEXT("ArchiveSizeRatioColumn", "Ratio"))
+			.FillWidth(0.16f);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		// Toolbar
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(ArchiveSizeLayoutConstants::SectionPadding)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(ArchiveSizeLayoutConstants::ControlPadding)
+			[
+				SNew(SBox)
+				.WidthOverride(ArchiveSizeLayoutConstants::ProgressWidth)
+				[
+					SNew(SProgressBar)
+					.Percent(this, &SArchiveSizePanel::GetProgress)
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(ArchiveSizeLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("ArchiveSizeCancel", "Cancel"))
+				.OnClicked(this, &SArchiveSizePanel::OnCancelClicked)
+				.IsEnabled_Lambda([this]() { return bScanning; })
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(ArchiveSizeLayoutConstants::ControlPadding)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda([this]() { return bFullScan ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged(this, &SArchiveSizePanel::OnFullScanChanged)
+				.ToolTipText(FText::Format(LOCTEXT("ArchiveSizeFullTooltip", "Measure every instance instead of up to {0} evenly spaced instances per class"), FText::AsNumber(FObjectProfilerArchiveSizer::DefaultSamplesPerClass)))
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("ArchiveSizeFull", "All Instances"))
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			.Padding(ArchiveSizeLayoutConstants::SectionPadding, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SArchiveSizePanel::GetSummaryText)
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(ArchiveSizeLayoutConstants::SectionPadding)
+		[
+			SAssignNew(EntryListView, SListView<TSharedPtr<FArchiveSizeEntry>>)
+			.ListItemsSource(&EntryItems)
+			.OnGenerateRow(this, &SArchiveSizePanel::OnGenerateRowForList)
+			.SelectionMode(ESelectionMode::Single)
+			.HeaderRow(HeaderRow)
+		]
+	];
+
+	StartScan();
+}
+
+SArchiveSizePanel::~SArchiveSizePanel()
+{
+	if (bScanning)
+	{
+		FObjectProfilerArchiveSizer::Cancel();
+	}
+}
+
+void SArchiveSizePanel::StartScan()
+{
+	if (bScanning)
+	{
+		FObjectProfilerArchiveSizer::Cancel();
+	}
+
+	const int32 MaxSamples = bFullScan ? 0 : FObjectProfilerArchiveSizer::DefaultSamplesPerClass;
+	bScanning = FObjectProfilerArchiveSizer::Start(Stats, MaxSamples, FOnArchiveSizeComplete::CreateSP(this, &SArchiveSizePanel::OnScanComplete));
+	bScanRejected = !bScanning;
+}
+
+TSharedRef<ITableRow> SArchiveSizePanel::OnGenerateRowForList(TSharedPtr<FArchiveSizeEntry> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SArchiveSizeRow, OwnerTable)
+		.Item(Item);
+}
+
+void SArchiveSizePanel::OnScanComplete(const TArray<FArchiveSizeEntry>& Results)
+{
+	bScanning = false;
+
+	EntryItems.Reset(Results.Num());
+	for (const FArchiveSizeEntry& Entry : Results)
+	{
+		EntryItems.Add(MakeShared<FArchiveSizeEntry>(Entry));
+	}
+
+	EntryListView->RequestListRefresh();
+}
+
+FReply SArchiveSizePanel::OnCancelClicked()
+{
+	FObjectProfilerArchiveSizer::Cancel();
+	bScanning = false;
+	return FReply::Handled();
+}
+
+void SArchiveSizePanel::OnFullScanChanged(ECheckBoxState NewState)
+{
+	bFullScan = NewState == ECheckBoxState::Checked;
+	StartScan();
+}
+
+TOptional<float> SArchiveSizePanel::GetProgress() const
+{
+	return bScanning ? FObjectProfilerArchiveSizer::GetProgress() : 1.0f;
+}
+
+FText SArchiveSizePanel::GetSummaryText() const
+{
+	if (bScanRejected)
+	{
+		return LOCTEXT("ArchiveSizeBusy", "Another archive size scan is already running. Close it and try again.");
+	}
+
+	if (bScanning)
+	{
+		return FText::Format(LOCTEXT("ArchiveSizeScanning", "Serializing instances of {0} classes into a counting archive..."), FText::AsNumber(Stats.Num()));
+	}
+
+	int32 UnderReportingCount = 0;
+	int64 UnderReportedBytes = 0;
+	for (const TSharedPtr<FArchiveSizeEntry>& Entry : EntryItems)
+	{
+		if (Entry->GetUnderReportedBytes() > 0)
+		{
+			UnderReportingCount++;
+			UnderReportedBytes += Entry->GetUnderReportedBytes();
+		}
+	}
+
+	return FText::Format(LOCTEXT("ArchiveSizeSummary", "{0} of {1} classes under-report by {2} in total"),
+		FText::AsNumber(UnderReportingCount),
+		FText::AsNumber(EntryItems.Num()),
+		FText::FromString(FObjectProfilerCore::FormatBytes(UnderReportedBytes)));
+}
+
+void SArchiveSizeRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Item = InArgs._Item;
+	SMultiColumnTableRow<TSharedPtr<FArchiveSizeEntry>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SArchiveSizeRow::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (!Item.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	FText CellText;
+	if (ColumnName == ArchiveSizeColumns::Class)
+	{
+		CellText = FText::FromString(Item->ClassName);
+	}
+	else if (ColumnName == ArchiveSizeColumns::Instances)
+	{
+		CellText = FText::AsNumber(Item->InstanceCount);
+	}
+	else if (ColumnName == ArchiveSizeColumns::Measured)
+	{
+		CellText = FText::AsNumber(Item->MeasuredCount);
+	}
+	else if (ColumnName == ArchiveSizeColumns::ResourceSize)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->GetEstimatedResourceBytes()));
+	}
+	else if (ColumnName == ArchiveSizeColumns::ArchiveSize)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->GetEstimatedArchiveBytes()));
+	}
+	else if (ColumnName == ArchiveSizeColumns::Ratio)
+	{
+		const int64 ResourceBytes = Item->GetEstimatedResourceBytes();
+		CellText = ResourceBytes > 0
+			? FText::Format(LOCTEXT("ArchiveSizeRatioValue", "{0}x"), FText::AsNumber(static_cast<double>(Item->GetEstimatedArchiveBytes()) / ResourceBytes))
+			: LOCTEXT("ArchiveSizeRatioUnreported", "not reported");
+	}
+
+	return SNew(SBox)
+		.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		[
+			SNew(STextBlock)
+			.Text(CellText)
+			.ToolTipText(CellText)
+			.Margin(FMargin(4.0f, 2.0f))
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
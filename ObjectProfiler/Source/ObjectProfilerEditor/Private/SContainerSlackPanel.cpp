@@ -0,0 +1,279 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "SContainerSlackPanel.h"
+#include "ObjectProfilerCore.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Notifications/SProgressBar.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "ObjectProfiler"
+
+namespace ContainerSlackColumns
+{
+	static const FName Class("Class");
+	static const FName Property("Property");
+	static const FName Type("Type");
+	static const FName Instances("Instances");
+	static const FName Used("Used");
+	static const FName Allocated("Allocated");
+	static const FName Wasted("Wasted");
+}
+
+namespace SlackLayoutConstants
+{
+	constexpr float SectionPadding = 8.0f;
+	constexpr float ControlPadding = 4.0f;
+	constexpr float ProgressWidth = 200.0f;
+}
+
+void SContainerSlackPanel::Construct(const FArguments& InArgs)
+{
+	ClassCount = InArgs._Classes.Num();
+
+	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
+		+ SHeaderRow::Column(ContainerSlackColumns::Class)
+			.DefaultLabel(LOCTEXT("SlackClassColumn", "Class"))
+			.FillWidth(0.2f)
+		+ SHeaderRow::Column(ContainerSlackColumns::Property)
+			.DefaultLabel(LOCTEXT("SlackPropertyColumn", "Property"))
+			.FillWidth(0.25f)
+		+ SHeaderRow::Column(ContainerSlackColumns::Type)
+			.DefaultLabel(LOCTEXT("SlackTypeColumn", "Type"))
+			.FillWidth(0.07f)
+		+ SHeaderRow::Column(ContainerSlackColumns::Instances)
+			.DefaultLabel(LOCTEXT("SlackInstancesColumn", "Instances"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(ContainerSlackColumns::Used)
+			.DefaultLabel(LOCTEXT("SlackUsedColumn", "Used"))
+			.FillWidth(0.12f)
+		+ SHeaderRow::Column(ContainerSlackColumns::Allocated)
+			.DefaultLabel(LOCTEXT("SlackAllocatedColumn", "Allocated"))
+			.FillWidth(0.12f)
+		+ SHeaderRow::Column(ContainerSlackColumns::Wasted)
+			.DefaultLabel(LOCTEXT("SlackWastedColumn", "Wasted"))
+			.FillWidth(0.14f);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		// Toolbar
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(SlackLayoutConstants::SectionPadding)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(SlackLayoutConstants::ControlPadding)
+			[
+				SNew(SBox)
+				.WidthOverride(SlackLayoutConstants::ProgressWidth)
+				[
+					SNew(SProgressBar)
+					.Percent(this, &SContainerSlackPanel::GetProgress)
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(SlackLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("SlackCancel", "Cancel"))
+				.OnClicked(this, &SContainerSlackPanel::OnCancelClicked)
+				.IsEnabled_Lambda([this]() { return bScanning; })
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			.Padding(SlackLayoutConstants::SectionPadding, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SContainerSlackPanel::GetSummaryText)
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(SlackLayoutConstants::SectionPadding)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+
+			// Property list
+			+ SSplitter::Slot()
+			.Value(0.7f)
+			[
+				SAssignNew(EntryListView, SListView<TSharedPtr<FContainerSlackEntry>>)
+				.ListItemsSource(&EntryItems)
+				.OnGenerateRow(this, &SContainerSlackPanel::OnGenerateRowForList)
+				.OnSelectionChanged(this, &SContainerSlackPanel::OnSelectionChanged)
+				.SelectionMode(ESelectionMode::Single)
+				.HeaderRow(HeaderRow)
+			]
+
+			// Example instances
+			+ SSplitter::Slot()
+			.Value(0.3f)
+			[
+				SNew(SScrollBox)
+				+ SScrollBox::Slot()
+				[
+					SNew(STextBlock)
+					.Text(this, &SContainerSlackPanel::GetExamplesText)
+				]
+			]
+		]
+	];
+
+	bScanning = FObjectProfilerContainerSlack::Start(InArgs._Classes, FOnContainerSlackComplete::CreateSP(this, &SContainerSlackPanel::OnScanComplete));
+	bScanRejected = !bScanning;
+}
+
+SContainerSlackPanel::~SContainerSlackPanel()
+{
+	if (bScanning)
+	{
+		FObjectProfilerContainerSlack::Cancel();
+	}
+}
+
+TSharedRef<ITableRow> SContainerSlackPanel::OnGenerateRowForList(TSharedPtr<FContainerSlackEntry> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SContainerSlackRow, OwnerTable)
+		.Item(Item);
+}
+
+void SContainerSlackPanel::OnSelectionChanged(TSharedPtr<FContainerSlackEntry> Item, ESelectInfo::Type SelectInfo)
+{
+	SelectedEntry = Item;
+}
+
+void SContainerSlackPanel::OnScanComplete(const TArray<FContainerSlackEntry>& Results)
+{
+	bScanning = false;
+
+	EntryItems.Reset(Results.Num());
+	for (const FContainerSlackEntry& Entry : Results)
+	{
+		EntryItems.Add(MakeShared<FContainerSlackEntry>(Entry));
+	}
+
+	EntryListView->RequestListRefresh();
+}
+
+FReply SContainerSlackPanel::OnCancelClicked()
+{
+	FObjectProfilerContainerSlack::Cancel();
+	bScanning = false;
+	return FReply::Handled();
+}
+
+TOptional<float> SContainerSlackPanel::GetProgress() const
+{
+	return bScanning ? FObjectProfilerContainerSlack::GetProgress() : 1.0f;
+}
+
+FText SContainerSlackPanel::GetSummaryText() const
+{
+	if (bScanRejected)
+	{
+		return LOCTEXT("SlackBusy", "Another container scan is already running. Close it and try again.");
+	}
+
+	if (bScanning)
+	{
+		return FText::Format(LOCTEXT("SlackScanning", "Reading container properties on every instance of {0} classes..."), FText::AsNumber(ClassCount));
+	}
+
+	int64 TotalWasted = 0;
+	for (const TSharedPtr<FContainerSlackEntry>& Entry : EntryItems)
+	{
+		TotalWasted += Entry->GetWastedBytes();
+	}
+
+	return FText::Format(LOCTEXT("SlackSummary", "{0} container properties across {1} classes hold {2} of unused capacity"),
+		FText::AsNumber(EntryItems.Num()),
+		FText::AsNumber(ClassCount),
+		FText::FromString(FObjectProfilerCore::FormatBytes(TotalWasted)));
+}
+
+FText SContainerSlackPanel::GetExamplesText() const
+{
+	if (!SelectedEntry.IsValid())
+	{
+		return LOCTEXT("SlackNoSelection", "Select a property to see the instances with the most unused capacity.");
+	}
+
+	TArray<FString> Lines;
+	for (const TPair<FString, int64>& Example : SelectedEntry->Examples)
+	{
+		Lines.Add(FString::Printf(TEXT("%s  %s"), *FObjectProfilerCore::FormatBytes(Example.Value), *Example.Key));
+	}
+
+	return FText::FromString(FString::Join(Lines, TEXT("\n")));
+}
+
+void SContainerSlackRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Item = InArgs._Item;
+	SMultiColumnTableRow<TSharedPtr<FContainerSlackEntry>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SContainerSlackRow::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (!Item.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	FText CellText;
+	if (ColumnName == ContainerSlackColumns::Class)
+	{
+		CellText = FText::FromString(Item->ClassName);
+	}
+	else if (ColumnName == ContainerSlackColumns::Property)
+	{
+		CellText = FText::FromString(Item->PropertyName);
+	}
+	else if (ColumnName == ContainerSlackColumns::Type)
+	{
+		CellText = FText::FromString(Item->ContainerType);
+	}
+	else if (ColumnName == ContainerSlackColumns::Instances)
+	{
+		CellText = FText::AsNumber(Item->InstanceCount);
+	}
+	else if (ColumnName == ContainerSlackColumns::Used)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->UsedBytes));
+	}
+	else if (ColumnName == ContainerSlackColumns::Allocated)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->AllocatedBytes));
+	}
+	else if (ColumnName == ContainerSlackColumns::Wasted)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->GetWastedBytes()));
+	}
+
+	return SNew(SBox)
+		.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		[
+			SNew(STextBlock)
+			.Text(CellText)
+			.ToolTipText(CellText)
+			.Margin(FMargin(4.0f, 2.0f))
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,257 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "SDuplicateContentPanel.h"
+#include "ObjectProfilerCore.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Notifications/SProgressBar.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "ObjectProfiler"
+
+namespace DuplicateContentColumns
+{
+	static const FName Class("Class");
+	static const FName Example("Example");
+	static const FName Copies("Copies");
+	static const FName SizeEach("SizeEach");
+	static const FName Wasted("Wasted");
+}
+
+namespace DuplicateLayoutConstants
+{
+	constexpr float SectionPadding = 8.0f;
+	constexpr float ControlPadding = 4.0f;
+	constexpr float ProgressWidth = 200.0f;
+}
+
+void SDuplicateContentPanel::Construct(const FArguments& InArgs)
+{
+	ClassCount = InArgs._Classes.Num();
+
+	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
+		+ SHeaderRow::Column(DuplicateContentColumns::Class)
+			.DefaultLabel(LOCTEXT("DuplicateClassColumn", "Class"))
+			.FillWidth(0.2f)
+		+ SHeaderRow::Column(DuplicateContentColumns::Example)
+			.DefaultLabel(LOCTEXT("DuplicateExampleColumn", "Example"))
+			.FillWidth(0.4f)
+		+ SHeaderRow::Column(DuplicateContentColumns::Copies)
+			.DefaultLabel(LOCTEXT("DuplicateCopiesColumn", "Copies"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(DuplicateContentColumns::SizeEach)
+			.DefaultLabel(LOCTEXT("DuplicateSizeEachColumn", "Size Each"))
+			.FillWidth(0.15f)
+		+ SHeaderRow::Column(DuplicateContentColumns::Wasted)
+			.DefaultLabel(LOCTEXT("DuplicateWastedColumn", "Wasted"))
+			.FillWidth(0.15f);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		// Toolbar
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(DuplicateLayoutConstants::SectionPadding)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(DuplicateLayoutConstants::ControlPadding)
+			[
+				SNew(SBox)
+				.WidthOverride(DuplicateLayoutConstants::ProgressWidth)
+				[
+					SNew(SProgressBar)
+					.Percent(this, &SDuplicateContentPanel::GetProgress)
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(DuplicateLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("DuplicateCancel", "Cancel"))
+				.OnClicked(this, &SDuplicateContentPanel::OnCancelClicked)
+				.IsEnabled_Lambda([this]() { return bScanning; })
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			.Padding(DuplicateLayoutConstants::SectionPadding, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SDuplicateContentPanel::GetSummaryText)
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(DuplicateLayoutConstants::SectionPadding)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+
+			// Cluster list
+			+ SSplitter::Slot()
+			.Value(0.65f)
+			[
+				SAssignNew(ClusterListView, SListView<TSharedPtr<FDuplicateCluster>>)
+				.ListItemsSource(&ClusterItems)
+				.OnGenerateRow(this, &SDuplicateContentPanel::OnGenerateRowForList)
+				.OnSelectionChanged(this, &SDuplicateContentPanel::OnSelectionChanged)
+				.SelectionMode(ESelectionMode::Single)
+				.HeaderRow(HeaderRow)
+			]
+
+			// Cluster members
+			+ SSplitter::Slot()
+			.Value(0.35f)
+			[
+				SNew(SScrollBox)
+				+ SScrollBox::Slot()
+				[
+					SNew(STextBlock)
+					.Text(this, &SDuplicateContentPanel::GetMembersText)
+				]
+			]
+		]
+	];
+
+	bScanning = FObjectProfilerDuplicateDetector::Start(InArgs._Classes, FOnDuplicateScanComplete::CreateSP(this, &SDuplicateContentPanel::OnScanComplete));
+	bScanRejected = !bScanning;
+}
+
+SDuplicateContentPanel::~SDuplicateContentPanel()
+{
+	if (bScanning)
+	{
+		FObjectProfilerDuplicateDetector::Cancel();
+	}
+}
+
+TSharedRef<ITableRow> SDuplicateContentPanel::OnGenerateRowForList(TSharedPtr<FDuplicateCluster> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SDuplicateClusterRow, OwnerTable)
+		.Item(Item);
+}
+
+void SDuplicateContentPanel::OnSelectionChanged(TSharedPtr<FDuplicateCluster> Item, ESelectInfo::Type SelectInfo)
+{
+	SelectedCluster = Item;
+}
+
+void SDuplicateContentPanel::OnScanComplete(const TArray<FDuplicateCluster>& Results)
+{
+	bScanning = false;
+
+	ClusterItems.Reset(Results.Num());
+	for (const FDuplicateCluster& Cluster : Results)
+	{
+		ClusterItems.Add(MakeShared<FDuplicateCluster>(Cluster));
+	}
+
+	ClusterListView->RequestListRefresh();
+}
+
+FReply SDuplicateContentPanel::OnCancelClicked()
+{
+	FObjectProfilerDuplicateDetector::Cancel();
+	bScanning = false;
+	return FReply::Handled();
+}
+
+TOptional<float> SDuplicateContentPanel::GetProgress() const
+{
+	return bScanning ? FObjectProfilerDuplicateDetector::GetProgress() : 1.0f;
+}
+
+FText SDuplicateContentPanel::GetSummaryText() const
+{
+	if (bScanRejected)
+	{
+		return LOCTEXT("DuplicateBusy", "Another duplicate scan is already running. Close it and try again.");
+	}
+
+	if (bScanning)
+	{
+		return FText::Format(LOCTEXT("DuplicateScanning", "Hashing serialized state of assets in {0} classes..."), FText::AsNumber(ClassCount));
+	}
+
+	int64 TotalWasted = 0;
+	for (const TSharedPtr<FDuplicateCluster>& Cluster : ClusterItems)
+	{
+		TotalWasted += Cluster->GetWastedBytes();
+	}
+
+	return FText::Format(LOCTEXT("DuplicateSummary", "{0} clusters of identical assets across {1} classes waste {2}"),
+		FText::AsNumber(ClusterItems.Num()),
+		FText::AsNumber(ClassCount),
+		FText::FromString(FObjectProfilerCore::FormatBytes(TotalWasted)));
+}
+
+FText SDuplicateContentPanel::GetMembersText() const
+{
+	if (!SelectedCluster.IsValid())
+	{
+		return LOCTEXT("DuplicateNoSelection", "Select a cluster to see every object with identical content.");
+	}
+
+	return FText::FromString(FString::Join(SelectedCluster->ObjectPaths, TEXT("\n")));
+}
+
+void SDuplicateClusterRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Item = InArgs._Item;
+	SMultiColumnTableRow<TSharedPtr<FDuplicateCluster>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SDuplicateClusterRow::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (!Item.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	FText CellText;
+	if (ColumnName == DuplicateContentColumns::Class)
+	{
+		CellText = FText::FromString(Item->ClassName);
+	}
+	else if (ColumnName == DuplicateContentColumns::Example)
+	{
+		CellText = Item->ObjectPaths.Num() > 0 ? FText::FromString(Item->ObjectPaths[0]) : FText::GetEmpty();
+	}
+	else if (ColumnName == DuplicateContentColumns::Copies)
+	{
+		CellText = FText::AsNumber(Item->ObjectPaths.Num());
+	}
+	else if (ColumnName == DuplicateContentColumns::SizeEach)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->SizeBytes));
+	}
+	else if (ColumnName == DuplicateContentColumns::Wasted)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->GetWastedBytes()));
+	}
+
+	return SNew(SBox)
+		.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		[
+			SNew(STextBlock)
+			.Text(CellText)
+			.ToolTipText(CellText)
+			.Margin(FMargin(4.0f, 2.0f))
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
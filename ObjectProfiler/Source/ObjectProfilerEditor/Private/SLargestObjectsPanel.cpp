@@ -0,0 +1,412 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "SLargestObjectsPanel.h"
+#include "SReferenceGraphWindow.h"
+#include "SPropertyBreakdownPanel.h"
+#include "ObjectProfilerCore.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Notifications/SProgressBar.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "ObjectProfiler"
+
+namespace LargestObjectColumns
+{
+	static const FName Size("Size");
+	static const FName Share("Share");
+	static const FName Object("Object");
+	static const FName Class("Class");
+	static const FName Outer("Outer");
+	static const FName World("World");
+}
+
+namespace LargestLayoutConstants
+{
+	constexpr float SectionPadding = 8.0f;
+	constexpr float ControlPadding = 4.0f;
+}
+
+void SLargestObjectsPanel::Construct(const FArguments& InArgs)
+{
+	RebuildSourceOptions();
+
+	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
+		+ SHeaderRow::Column(LargestObjectColumns::Size)
+			.DefaultLabel(LOCTEXT("LargestSizeColumn", "Size"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(LargestObjectColumns::Share)
+			.DefaultLabel(LOCTEXT("LargestShareColumn", "Relative"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(LargestObjectColumns::Object)
+			.DefaultLabel(LOCTEXT("LargestObjectColumn", "Path"))
+			.FillWidth(0.4f)
+		+ SHeaderRow::Column(LargestObjectColumns::Class)
+			.DefaultLabel(LOCTEXT("LargestClassColumn", "Class"))
+			.FillWidth(0.15f)
+		+ SHeaderRow::Column(LargestObjectColumns::Outer)
+			.DefaultLabel(LOCTEXT("LargestOuterColumn", "Outer"))
+			.FillWidth(0.15f)
+		+ SHeaderRow::Column(LargestObjectColumns::World)
+			.DefaultLabel(LOCTEXT("LargestWorldColumn", "World"))
+			.FillWidth(0.1f);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		// Toolbar
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(LargestLayoutConstants::SectionPadding)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(LargestLayoutConstants::ControlPadding)
+			[
+				SAssignNew(SourceCombo, SComboBox<TSharedPtr<FString>>)
+				.OptionsSource(&SourceOptions)
+				.OnSelectionChanged(this, &SLargestObjectsPanel::OnSourceChanged)
+				.OnGenerateWidget(this, &SLargestObjectsPanel::GenerateSourceComboContent)
+				.InitiallySelectedItem(CurrentSource)
+				.Content()
+				[
+					SNew(STextBlock)
+					.Text(this, &SLargestObjectsPanel::GetSourceText)
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(LargestLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LargestRefresh", "Refresh"))
+				.ToolTipText(LOCTEXT("LargestRefreshTooltip", "Walk the heap again and rebuild the list of largest objects"))
+				.OnClicked(this, &SLargestObjectsPanel::OnRefreshClicked)
+				.IsEnabled_Lambda([this]() { return !bWalkInFlight; })
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(LargestLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LargestFind", "Find"))
+				.ToolTipText(LOCTEXT("LargestFindTooltip", "Select the owning actor or sync the Content Browser to the asset"))
+				.OnClicked(this, &SLargestObjectsPanel::OnFindClicked)
+				.IsEnabled(this, &SLargestObjectsPanel::HasSelection)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(LargestLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LargestReferences", "References"))
+				.ToolTipText(LOCTEXT("LargestReferencesTooltip", "Show the reference graph for the selected object"))
+				.OnClicked(this, &SLargestObjectsPanel::OnReferencesClicked)
+				.IsEnabled(this, &SLargestObjectsPanel::HasSelection)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(LargestLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("LargestInspect", "Inspect"))
+				.ToolTipText(LOCTEXT("LargestInspectTooltip", "Break the selected object's memory down by reflected property"))
+				.OnClicked(this, &SLargestObjectsPanel::OnInspectClicked)
+				.IsEnabled(this, &SLargestObjectsPanel::HasSelection)
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			.Padding(LargestLayoutConstants::SectionPadding, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SLargestObjectsPanel::GetSummaryText)
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			]
+		]
+
+		// Object list
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(LargestLayoutConstants::SectionPadding)
+		[
+			SAssignNew(EntryListView, SListView<TSharedPtr<FLargestObjectEntry>>)
+			.ListItemsSource(&EntryItems)
+			.OnGenerateRow(this, &SLargestObjectsPanel::OnGenerateRowForList)
+			.OnMouseButtonDoubleClick(this, &SLargestObjectsPanel::OnEntryDoubleClicked)
+			.SelectionMode(ESelectionMode::Single)
+			.HeaderRow(HeaderRow)
+		]
+	];
+
+	LoadEntries();
+}
+
+TSharedRef<ITableRow> SLargestObjectsPanel::OnGenerateRowForList(TSharedPtr<FLargestObjectEntry> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SLargestObjectRow, OwnerTable)
+		.Item(Item)
+		.MaxEntrySize(MaxEntrySize);
+}
+
+void SLargestObjectsPanel::OnEntryDoubleClicked(TSharedPtr<FLargestObjectEntry> Item)
+{
+	if (Item.IsValid() && !FObjectProfilerCore::FocusObjectInEditor(Item->ObjectPath))
+	{
+		StatusMessage = FText::Format(LOCTEXT("LargestObjectGone", "{0} is no longer loaded."), FText::FromString(Item->ObjectPath));
+	}
+}
+
+TSharedRef<SWidget> SLargestObjectsPanel::GenerateSourceComboContent(TSharedPtr<FString> Item)
+{
+	return SNew(STextBlock).Text(FText::FromString(*Item));
+}
+
+void SLargestObjectsPanel::OnSourceChanged(TSharedPtr<FString> NewSource, ESelectInfo::Type SelectInfo)
+{
+	if (!NewSource.IsValid())
+	{
+		return;
+	}
+
+	CurrentSource = NewSource;
+	LoadEntries();
+}
+
+FText SLargestObjectsPanel::GetSourceText() const
+{
+	return CurrentSource.IsValid() ? FText::FromString(*CurrentSource) : FText::GetEmpty();
+}
+
+FReply SLargestObjectsPanel::OnRefreshClicked()
+{
+	RebuildSourceOptions();
+	SourceCombo->RefreshOptions();
+	SourceCombo->SetSelectedItem(CurrentSource);
+
+	if (SourceOptions.IndexOfByKey(CurrentSource) > 0)
+	{
+		LoadEntries();
+		return FReply::Handled();
+	}
+
+	FHeapWalkRequest Request;
+	Request.Needs = EHeapWalkNeeds::Sizes;
+
+	bWalkInFlight = true;
+	StatusMessage = LOCTEXT("LargestWalking", "Measuring objects...");
+	FObjectProfilerCore::RequestHeapWalk(Request, FOnHeapWalkComplete::CreateSP(this, &SLargestObjectsPanel::OnHeapWalkComplete));
+
+	return FReply::Handled();
+}
+
+void SLargestObjectsPanel::OnHeapWalkComplete(const FHeapWalkResult& WalkResult)
+{
+	bWalkInFlight = false;
+	StatusMessage = WalkResult.bCancelled ? LOCTEXT("LargestCancelled", "Walk cancelled.") : FText::GetEmpty();
+	
+	if (!WalkResult.bCancelled)
+	{
+		LoadEntries();
+	}
+}
+
+FReply SLargestObjectsPanel::OnFindClicked()
+{
+	OnEntryDoubleClicked(GetSelectedEntry());
+	return FReply::Handled();
+}
+
+FReply SLargestObjectsPanel::OnReferencesClicked()
+{
+	TSharedPtr<FLargestObjectEntry> Entry = GetSelectedEntry();
+	if (!Entry.IsValid())
+	{
+		return FReply::Handled();
+	}
+
+	TSharedPtr<FObjectClassStats> ObjectStats = MakeShared<FObjectClassStats>();
+	ObjectStats->ClassName = Entry->ClassName;
+	ObjectStats->SampleObjectNames.Add(Entry->ObjectPath);
+
+	TSharedRef<SWindow> ReferenceWindow = SNew(SWindow)
+		.Title(FText::Format(LOCTEXT("LargestReferencesWindowTitle", "References: {0}"), FText::FromString(Entry->ObjectPath)))
+		.ClientSize(FVector2D(1000, 600))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SReferenceGraphWindow)
+			.ClassStats(ObjectStats)
+		];
+
+	FSlateApplication::Get().AddWindow(ReferenceWindow);
+
+	return FReply::Handled();
+}
+
+FReply SLargestObjectsPanel::OnInspectClicked()
+{
+	TSharedPtr<FLargestObjectEntry> Entry = GetSelectedEntry();
+	if (!Entry.IsValid())
+	{
+		return FReply::Handled();
+	}
+
+	TSharedRef<SWindow> BreakdownWindow = SNew(SWindow)
+		.Title(FText::Format(LOCTEXT("LargestBreakdownWindowTitle", "Property Memory: {0}"), FText::FromString(Entry->ObjectPath)))
+		.ClientSize(FVector2D(1000, 650))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SPropertyBreakdownPanel)
+			.ObjectPath(Entry->ObjectPath)
+		];
+
+	FSlateApplication::Get().AddWindow(BreakdownWindow);
+
+	return FReply::Handled();
+}
+
+bool SLargestObjectsPanel::HasSelection() const
+{
+	return GetSelectedEntry().IsValid();
+}
+
+TSharedPtr<FLargestObjectEntry> SLargestObjectsPanel::GetSelectedEntry() const
+{
+	if (!EntryListView.IsValid())
+	{
+		return nullptr;
+	}
+
+	TArray<TSharedPtr<FLargestObjectEntry>> Selected = EntryListView->GetSelectedItems();
+	return Selected.Num() > 0 ? Selected[0] : nullptr;
+}
+
+FText SLargestObjectsPanel::GetSummaryText() const
+{
+	if (!StatusMessage.IsEmpty())
+	{
+		return StatusMessage;
+	}
+
+	if (EntryItems.Num() == 0)
+	{
+		return LOCTEXT("LargestNoData", "No sized collection yet. Refresh to measure every object.");
+	}
+
+	int64 TotalSize = 0;
+	for (const TSharedPtr<FLargestObjectEntry>& Entry : EntryItems)
+	{
+		TotalSize += Entry->SizeBytes;
+	}
+
+	return FText::Format(LOCTEXT("LargestSummary", "{0} largest objects hold {1}"),
+		FText::AsNumber(EntryItems.Num()),
+		FText::FromString(FObjectProfilerCore::FormatBytes(TotalSize)));
+}
+
+void SLargestObjectsPanel::RebuildSourceOptions()
+{
+	const int32 PreviousIndex = SourceOptions.IndexOfByKey(CurrentSource);
+
+	SourceOptions.Reset();
+	SourceOptions.Add(MakeShared<FString>(TEXT("Last collection")));
+
+	for (const FObjectSnapshot& Snapshot : FObjectProfilerCore::GetSnapshotHistory())
+	{
+		SourceOptions.Add(MakeShared<FString>(Snapshot.GetDisplayName()));
+	}
+
+	CurrentSource = SourceOptions.IsValidIndex(PreviousIndex) ? SourceOptions[PreviousIndex] : SourceOptions[0];
+}
+
+void SLargestObjectsPanel::LoadEntries()
+{
+	const int32 SnapshotIndex = SourceOptions.IndexOfByKey(CurrentSource) - 1;
+	const TArray<FObjectSnapshot>& History = FObjectProfilerCore::GetSnapshotHistory();
+
+	const TArray<FLargestObjectEntry>& Entries = History.IsValidIndex(SnapshotIndex)
+		? History[SnapshotIndex].LargestObjects
+		: FObjectProfilerCore::GetLargestObjects();
+
+	EntryItems.Reset(Entries.Num());
+	MaxEntrySize = 1;
+
+	for (const FLargestObjectEntry& Entry : Entries)
+	{
+		EntryItems.Add(MakeShared<FLargestObjectEntry>(Entry));
+		MaxEntrySize = FMath::Max(MaxEntrySize, Entry.SizeBytes);
+	}
+
+	if (EntryListView.IsValid())
+	{
+		EntryListView->RequestListRefresh();
+	}
+}
+
+void SLargestObjectRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Item = InArgs._Item;
+	MaxEntrySize = FMath::Max<int64>(1, InArgs._MaxEntrySize);
+	SMultiColumnTableRow<TSharedPtr<FLargestObjectEntry>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SLargestObjectRow::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (!Item.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	FText CellText;
+	if (ColumnName == LargestObjectColumns::Size)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->SizeBytes));
+	}
+	else if (ColumnName == LargestObjectColumns::Share)
+	{
+		return SNew(SBox)
+			.Padding(FMargin(4.0f, 4.0f))
+			[
+				SNew(SProgressBar)
+				.Percent(static_cast<float>(static_cast<double>(Item->SizeBytes) / MaxEntrySize))
+			];
+	}
+	else if (ColumnName == LargestObjectColumns::Object)
+	{
+		CellText = FText::FromString(Item->ObjectPath);
+	}
+	else if (ColumnName == LargestObjectColumns::Class)
+	{
+		CellText = FText::FromString(Item->ClassName);
+	}
+	else if (ColumnName == LargestObjectColumns::Outer)
+	{
+		CellText = FText::FromString(Item->OuterName);
+	}
+	else if (ColumnName == LargestObjectColumns::World)
+	{
+		CellText = FText::FromName(Item->WorldLabel);
+	}
+
+	return SNew(SBox)
+		.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		[
+			SNew(STextBlock)
+			.Text(CellText)
+			.ToolTipText(CellText)
+			.Margin(FMargin(4.0f, 2.0f))
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
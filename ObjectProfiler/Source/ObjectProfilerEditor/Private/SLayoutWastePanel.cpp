@@ -0,0 +1,239 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "SLayoutWastePanel.h"
+#include "ObjectProfilerCore.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "ObjectProfiler"
+
+namespace LayoutWasteColumns
+{
+	static const FName Class("Class");
+	static const FName Instances("Instances");
+	static const FName PropertiesSize("PropertiesSize");
+	static const FName AllocationSize("AllocationSize");
+	static const FName Padding("Padding");
+	static const FName BinWaste("BinWaste");
+	static const FName TotalWaste("TotalWaste");
+	static const FName Reorder("Reorder");
+}
+
+namespace LayoutWasteLayoutConstants
+{
+	constexpr float SectionPadding = 8.0f;
+}
+
+void SLayoutWastePanel::Construct(const FArguments& InArgs)
+{
+	for (FClassLayoutReport& Report : FObjectProfilerLayoutAnalyzer::Analyze(InArgs._Stats))
+	{
+		ReportItems.Add(MakeShared<FClassLayoutReport>(MoveTemp(Report)));
+	}
+
+	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
+		+ SHeaderRow::Column(LayoutWasteColumns::Class)
+			.DefaultLabel(LOCTEXT("LayoutClassColumn", "Class"))
+			.FillWidth(0.25f)
+		+ SHeaderRow::Column(LayoutWasteColumns::Instances)
+			.DefaultLabel(LOCTEXT("LayoutInstancesColumn", "Instances"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(LayoutWasteColumns::PropertiesSize)
+			.DefaultLabel(LOCTEXT("LayoutPropertiesSizeColumn", "Object Size"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(LayoutWasteColumns::AllocationSize)
+			.DefaultLabel(LOCTEXT("LayoutAllocationSizeColumn", "Allocated"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(LayoutWasteColumns::Padding)
+			.DefaultLabel(LOCTEXT("LayoutPaddingColumn", "Padding"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(LayoutWasteColumns::BinWaste)
+			.DefaultLabel(LOCTEXT("LayoutBinWasteColumn", "Bin Waste"))
+			.FillWidth(0.1f)
+		+ SHeaderRow::Column(LayoutWasteColumns::TotalWaste)
+			.DefaultLabel(LOCTEXT("LayoutTotalWasteColumn", "Total Waste"))
+			.FillWidth(0.12f)
+		+ SHeaderRow::Column(LayoutWasteColumns::Reorder)
+			.DefaultLabel(LOCTEXT("LayoutReorderColumn", "Reorder Saves"))
+			.FillWidth(0.13f);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(LayoutWasteLayoutConstants::SectionPadding)
+		[
+			SNew(STextBlock)
+			.Text(this, &SLayoutWastePanel::GetSummaryText)
+			.AutoWrapText(true)
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(LayoutWasteLayoutConstants::SectionPadding)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+
+			// Class list
+			+ SSplitter::Slot()
+			.Value(0.6f)
+			[
+				SAssignNew(ReportListView, SListView<TSharedPtr<FClassLayoutReport>>)
+				.ListItemsSource(&ReportItems)
+				.OnGenerateRow(this, &SLayoutWastePanel::OnGenerateRowForList)
+				.OnSelectionChanged(this, &SLayoutWastePanel::OnSelectionChanged)
+				.SelectionMode(ESelectionMode::Single)
+				.HeaderRow(HeaderRow)
+			]
+
+			// Gaps and suggested order
+			+ SSplitter::Slot()
+			.Value(0.4f)
+			[
+				SNew(SScrollBox)
+				+ SScrollBox::Slot()
+				[
+					SNew(STextBlock)
+					.Text(this, &SLayoutWastePanel::GetDetailsText)
+					.AutoWrapText(true)
+				]
+			]
+		]
+	];
+}
+
+TSharedRef<ITableRow> SLayoutWastePanel::OnGenerateRowForList(TSharedPtr<FClassLayoutReport> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SLayoutWasteRow, OwnerTable)
+		.Item(Item);
+}
+
+void SLayoutWastePanel::OnSelectionChanged(TSharedPtr<FClassLayoutReport> Item, ESelectInfo::Type SelectInfo)
+{
+	SelectedReport = Item;
+}
+
+FText SLayoutWastePanel::GetSummaryText() const
+{
+	if (ReportItems.Num() == 0)
+	{
+		return FText::Format(LOCTEXT("LayoutNoData", "No live class has {0} or more instances. Refresh the profiler first."),
+			FText::AsNumber(FObjectProfilerLayoutAnalyzer::DefaultMinInstanceCount));
+	}
+
+	int64 TotalWaste = 0;
+	for (const TSharedPtr<FClassLayoutReport>& Report : ReportItems)
+	{
+		TotalWaste += Report->GetTotalWasteBytes();
+	}
+
+	return FText::Format(LOCTEXT("LayoutSummary", "{0} classes with {1}+ instances waste {2} in padding and allocator rounding."),
+		FText::AsNumber(ReportItems.Num()),
+		FText::AsNumber(FObjectProfilerLayoutAnalyzer::DefaultMinInstanceCount),
+		FText::FromString(FObjectProfilerCore::FormatBytes(TotalWaste)));
+}
+
+FText SLayoutWastePanel::GetDetailsText() const
+{
+	if (!SelectedReport.IsValid())
+	{
+		return LOCTEXT("LayoutNoSelection", "Select a class to see its padding holes and a suggested member order.");
+	}
+
+	const FClassLayoutReport& Report = *SelectedReport;
+	TArray<FString> Lines;
+
+	Lines.Add(FString::Printf(TEXT("%s: %d bytes, %d-byte aligned, %d bytes allocated (%s)"),
+		*Report.ClassName,
+		Report.PropertiesSize,
+		Report.MinAlignment,
+		Report.AllocationSize,
+		Report.bAllocationMeasured ? TEXT("measured") : TEXT("allocator size class")));
+
+	for (const FClassLayoutGap& Gap : Report.Gaps)
+	{
+		Lines.Add(FString::Printf(TEXT("  +%d: %d bytes after %s%s"),
+			Gap.Offset,
+			Gap.Size,
+			*Gap.AfterProperty,
+			Gap.bUnreflected ? TEXT(" (unreflected members, not counted)") : TEXT("")));
+	}
+
+	if (Report.SuggestedOrder.Num() > 0)
+	{
+		Lines.Add(FString::Printf(TEXT("Declaring %s's own members as below saves %d bytes per instance (%s in total):"),
+			*Report.ClassName,
+			Report.ReorderSavingBytes,
+			*FObjectProfilerCore::FormatBytes(static_cast<int64>(Report.ReorderSavingBytes) * Report.InstanceCount)));
+		Lines.Add(TEXT("  ") + FString::Join(Report.SuggestedOrder, TEXT(", ")));
+	}
+
+	return FText::FromString(FString::Join(Lines, TEXT("\n")));
+}
+
+void SLayoutWasteRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Item = InArgs._Item;
+	SMultiColumnTableRow<TSharedPtr<FClassLayoutReport>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SLayoutWasteRow::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (!Item.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	FText CellText;
+	if (ColumnName == LayoutWasteColumns::Class)
+	{
+		CellText = FText::FromString(Item->ClassName);
+	}
+	else if (ColumnName == LayoutWasteColumns::Instances)
+	{
+		CellText = FText::AsNumber(Item->InstanceCount);
+	}
+	else if (ColumnName == LayoutWasteColumns::PropertiesSize)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->PropertiesSize));
+	}
+	else if (ColumnName == LayoutWasteColumns::AllocationSize)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->AllocationSize));
+	}
+	else if (ColumnName == LayoutWasteColumns::Padding)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->PaddingBytes));
+	}
+	else if (ColumnName == LayoutWasteColumns::BinWaste)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->BinWasteBytes));
+	}
+	else if (ColumnName == LayoutWasteColumns::TotalWaste)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->GetTotalWasteBytes()));
+	}
+	else if (ColumnName == LayoutWasteColumns::Reorder)
+	{
+		CellText = Item->ReorderSavingBytes > 0
+			? FText::FromString(FObjectProfilerCore::FormatBytes(static_cast<int64>(Item->ReorderSavingBytes) * Item->InstanceCount))
+			: FText::GetEmpty();
+	}
+
+	return SNew(SBox)
+		.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		[
+			SNew(STextBlock)
+			.Text(CellText)
+			.ToolTipText(CellText)
+			.Margin(FMargin(4.0f, 2.0f))
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,216 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "SMemoryReconciliationPanel.h"
+#include "SSparkline.h"
+#include "ObjectProfilerCore.h"
+#include "ObjectProfilerMemoryReconciliation.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Layout/SSeparator.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "ObjectProfiler"
+
+namespace ReconciliationLayoutConstants
+{
+	constexpr float SectionPadding = 8.0f;
+	constexpr float SparklineHeight = 60.0f;
+	constexpr float LabelWidth = 0.4f;
+	constexpr float ValueWidth = 0.3f;
+}
+
+static FString FormatSignedBytes(int64 Bytes)
+{
+	return Bytes < 0 ? TEXT("-") + FObjectProfilerCore::FormatBytes(-Bytes) : FObjectProfilerCore::FormatBytes(Bytes);
+}
+
+void SMemoryReconciliationPanel::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(ReconciliationLayoutConstants::SectionPadding)
+		[
+			SNew(STextBlock)
+			.Text(this, &SMemoryReconciliationPanel::GetSummaryText)
+			.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
+			.AutoWrapText(true)
+		]
+
+		// Unattributed history
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(ReconciliationLayoutConstants::SectionPadding, 0.0f)
+		[
+			SNew(STextBlock)
+			.Text(LOCTEXT("ReconciliationSparklineLabel", "Unattributed memory over time"))
+			.Font(FCoreStyle::GetDefaultFontStyle("Bold", 10))
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(ReconciliationLayoutConstants::SectionPadding)
+		[
+			SNew(SBox)
+			.HeightOverride(ReconciliationLayoutConstants::SparklineHeight)
+			[
+				SAssignNew(UnattributedSparkline, SSparkline)
+				.LineColor(FLinearColor(0.9f, 0.6f, 0.2f))
+				.FillColor(FLinearColor(0.9f, 0.6f, 0.2f, 0.2f))
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(ReconciliationLayoutConstants::SectionPadding)
+		[
+			SNew(SScrollBox)
+
+			+ SScrollBox::Slot()
+			[
+				SAssignNew(TotalsBox, SVerticalBox)
+			]
+
+			+ SScrollBox::Slot()
+			.Padding(0.0f, ReconciliationLayoutConstants::SectionPadding)
+			[
+				SNew(SSeparator)
+			]
+
+			+ SScrollBox::Slot()
+			[
+				SAssignNew(CategoriesBox, SVerticalBox)
+			]
+		]
+	];
+
+	Rebuild();
+	RegisterActiveTimer(RefreshIntervalSeconds, FWidgetActiveTimerDelegate::CreateSP(this, &SMemoryReconciliationPanel::OnRefreshTimer));
+}
+
+EActiveTimerReturnType SMemoryReconciliationPanel::OnRefreshTimer(double InCurrentTime, float InDeltaTime)
+{
+	const TArray<FMemoryReconciliationSample>& Samples = FObjectProfilerMemoryReconciliation::GetSamples();
+	const double SampleTime = Samples.Num() > 0 ? Samples.Last().Timestamp : 0.0;
+
+	if (Samples.Num() != LastSampleCount || SampleTime != LastSampleTime)
+	{
+		Rebuild();
+	}
+
+	return EActiveTimerReturnType::Continue;
+}
+
+void SMemoryReconciliationPanel::Rebuild()
+{
+	const TArray<FMemoryReconciliationSample>& Samples = FObjectProfilerMemoryReconciliation::GetSamples();
+	LastSampleCount = Samples.Num();
+	LastSampleTime = Samples.Num() > 0 ? Samples.Last().Timestamp : 0.0;
+
+	TArray<float> UnattributedValues;
+	UnattributedValues.Reserve(Samples.Num());
+	for (const FMemoryReconciliationSample& Sample : Samples)
+	{
+		UnattributedValues.Add(static_cast<float>(Sample.GetUnattributedBytes() / (1024.0 * 1024.0)));
+	}
+	UnattributedSparkline->SetValues(UnattributedValues);
+
+	TotalsBox->ClearChildren();
+	CategoriesBox->ClearChildren();
+
+	if (Samples.Num() == 0)
+	{
+		return;
+	}
+
+	auto Bytes = [](int64 Value) { return FText::FromString(FObjectProfilerCore::FormatBytes(Value)); };
+	const FText NotAvailable = LOCTEXT("ReconciliationNotAvailable", "-");
+	const FMemoryReconciliationSample& Latest = Samples.Last();
+
+	AddRow(TotalsBox, LOCTEXT("ReconciliationTotal", "Total"), LOCTEXT("ReconciliationProfilerColumn", "Profiler"), LOCTEXT("ReconciliationReferenceColumn", "Process / LLM"), true);
+	AddRow(TotalsBox, LOCTEXT("ReconciliationPhysical", "Process physical"), NotAvailable, Bytes(Latest.ProcessPhysicalBytes));
+	AddRow(TotalsBox, LOCTEXT("ReconciliationVirtual", "Process virtual"), NotAvailable, Bytes(Latest.ProcessVirtualBytes));
+	AddRow(TotalsBox, LOCTEXT("ReconciliationLLMTracked", "LLM tracked total"), NotAvailable, Latest.bHasLLM ? Bytes(Latest.LLMTrackedBytes) : NotAvailable);
+	AddRow(TotalsBox, LOCTEXT("ReconciliationUObjects", "UObjects"), Bytes(Latest.AttributedBytes), Latest.bHasLLM ? Bytes(Latest.LLMUObjectBytes) : NotAvailable);
+	AddRow(TotalsBox, LOCTEXT("ReconciliationUObjectsVideo", "UObjects in video memory"), Bytes(Latest.AttributedVideoBytes), NotAvailable);
+	AddRow(TotalsBox, LOCTEXT("ReconciliationUnattributed", "Unattributed"), NotAvailable, FText::FromString(FormatSignedBytes(Latest.GetUnattributedBytes())));
+
+	const FMemoryReconciliationSample* CategorySample = FObjectProfilerMemoryReconciliation::GetLatestCategorySample();
+	if (!CategorySample)
+	{
+		return;
+	}
+
+	TArray<TPair<EObjectCategory, int64>> Categories = CategorySample->CategoryBytes.Array();
+	Categories.Sort([](const TPair<EObjectCategory, int64>& A, const TPair<EObjectCategory, int64>& B) { return A.Value > B.Value; });
+
+	AddRow(CategoriesBox, LOCTEXT("ReconciliationCategory", "Category"), LOCTEXT("ReconciliationProfilerColumn", "Profiler"), LOCTEXT("ReconciliationLLMColumn", "LLM"), true);
+	for (const TPair<EObjectCategory, int64>& Category : Categories)
+	{
+		const int64* LLMBytes = Latest.LLMCategoryBytes.Find(Category.Key);
+		AddRow(CategoriesBox,
+			FText::FromString(FObjectProfilerCore::GetCategoryDisplayName(Category.Key)),
+			Bytes(Category.Value),
+			LLMBytes ? Bytes(*LLMBytes) : NotAvailable);
+	}
+}
+
+void SMemoryReconciliationPanel::AddRow(TSharedPtr<SVerticalBox> Box, const FText& Label, const FText& ProfilerValue, const FText& ReferenceValue, bool bHeader)
+{
+	const FSlateFontInfo Font = bHeader ? FCoreStyle::GetDefaultFontStyle("Bold", 10) : FCoreStyle::GetDefaultFontStyle("Regular", 10);
+
+	Box->AddSlot()
+	.AutoHeight()
+	.Padding(2.0f)
+	[
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.FillWidth(ReconciliationLayoutConstants::LabelWidth)
+		[
+			SNew(STextBlock)
+			.Text(Label)
+			.Font(Font)
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		]
+		+ SHorizontalBox::Slot()
+		.FillWidth(ReconciliationLayoutConstants::ValueWidth)
+		[
+			SNew(STextBlock)
+			.Text(ProfilerValue)
+			.Font(Font)
+		]
+		+ SHorizontalBox::Slot()
+		.FillWidth(ReconciliationLayoutConstants::ValueWidth)
+		[
+			SNew(STextBlock)
+			.Text(ReferenceValue)
+			.Font(Font)
+		]
+	];
+}
+
+FText SMemoryReconciliationPanel::GetSummaryText() const
+{
+	const TArray<FMemoryReconciliationSample>& Samples = FObjectProfilerMemoryReconciliation::GetSamples();
+	if (Samples.Num() == 0)
+	{
+		return LOCTEXT("ReconciliationNoData", "No samples yet. Refresh or take a snapshot without a scope.");
+	}
+
+	const FMemoryReconciliationSample& Latest = Samples.Last();
+	const double AttributedPercent = Latest.ProcessPhysicalBytes > 0
+		? 100.0 * Latest.GetResidentAttributedBytes() / Latest.ProcessPhysicalBytes
+		: 0.0;
+
+	return FText::Format(LOCTEXT("ReconciliationSummary", "Process {0} | UObjects {1} ({2}%) | Unattributed {3}{4}"),
+		FText::FromString(FObjectProfilerCore::FormatBytes(Latest.ProcessPhysicalBytes)),
+		FText::FromString(FObjectProfilerCore::FormatBytes(Latest.GetResidentAttributedBytes())),
+		FText::AsNumber(FMath::RoundToInt(AttributedPercent)),
+		FText::FromString(FormatSignedBytes(Latest.GetUnattributedBytes())),
+		FObjectProfilerMemoryReconciliation::IsLLMAvailable() ? FText::GetEmpty() : LOCTEXT("ReconciliationNoLLM", " | LLM off (launch with -LLM)"));
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
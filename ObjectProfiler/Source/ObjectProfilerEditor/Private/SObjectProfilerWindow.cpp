@@ -4,11 +4,23 @@
 #include "SSparkline.h"
 #include "SSnapshotManager.h"
 #include "SReferenceGraphWindow.h"
+#include "SStartupTimelineWindow.h"
+#include "SLargestObjectsPanel.h"
+#include "SActorFootprintPanel.h"
+#include "SLayoutWastePanel.h"
+#include "SContainerSlackPanel.h"
+#include "SDuplicateContentPanel.h"
+#include "SArchiveSizePanel.h"
+#include "SPropertyBreakdownPanel.h"
+#include "SMemoryReconciliationPanel.h"
 #include "ObjectProfilerCore.h"
+#include "ObjectProfilerEventLog.h"
+#include "ObjectProfilerGovernor.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SComboBox.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SHyperlink.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Layout/SSeparator.h"
 #include "Widgets/Layout/SSplitter.h"
@@ -38,6 +50,8 @@ namespace ObjectProfilerColumns
 	static const FName Module("Module");
 	static const FName Category("Category");
 	static const FName Source("Source");
+	static const FName Package("Package");
+	static const FName Outer("Outer");
 }
 
 namespace ProfilerLayoutConstants
@@ -51,6 +65,8 @@ namespace ProfilerLayoutConstants
 	constexpr float RightPanelMinSize = 250.0f;
 	constexpr float LabelPadding = 4.0f;
 	constexpr float ControlPadding = 2.0f;
+	constexpr float ReplayCurveHeight = 48.0f;
+	constexpr int32 ReplayCurvePoints = 200;
 }
 
 void SObjectProfilerWindow::Construct(const FArguments& InArgs)
@@ -61,8 +77,16 @@ void SObjectProfilerWindow::Construct(const FArguments& InArgs)
 	CurrentViewMode = ViewModeOptions[0];
 	
 	GroupModeOptions.Add(MakeShared<FString>(TEXT("None")));
+	GroupModeOptions.Add(MakeShared<FString>(TEXT("By Source")));
 	GroupModeOptions.Add(MakeShared<FString>(TEXT("By Module")));
 	GroupModeOptions.Add(MakeShared<FString>(TEXT("By Category")));
+	GroupModeOptions.Add(MakeShared<FString>(TEXT("Source > Module")));
+	GroupModeOptions.Add(MakeShared<FString>(TEXT("Source > Module > Category")));
+	GroupModeOptions.Add(MakeShared<FString>(TEXT("Module > Category")));
+	GroupModeOptions.Add(MakeShared<FString>(TEXT("By Package")));
+	GroupModeOptions.Add(MakeShared<FString>(TEXT("By Outer")));
+	GroupModeOptions.Add(MakeShared<FString>(TEXT("By World")));
+	GroupModeOptions.Add(MakeShared<FString>(TEXT("By Class Hierarchy")));
 	CurrentGroupMode = GroupModeOptions[0];
 	
 	IntervalOptions.Add(MakeShared<FString>(TEXT("0.5s")));
@@ -152,6 +176,16 @@ void SObjectProfilerWindow::Construct(const FArguments& InArgs)
 			.DefaultLabel(LOCTEXT("CategoryColumn", "Category"))
 			.FillWidth(0.09f)
 			.SortMode(this, &SObjectProfilerWindow::GetSortModeForColumn, ObjectProfilerColumns::Category)
+			.OnSort(this, &SObjectProfilerWindow::OnSortColumnHeader)
+		+ SHeaderRow::Column(ObjectProfilerColumns::Package)
+			.DefaultLabel(LOCTEXT("PackageColumn", "Package"))
+			.FillWidth(0.15f)
+			.SortMode(this, &SObjectProfilerWindow::GetSortModeForColumn, ObjectProfilerColumns::Package)
+			.OnSort(this, &SObjectProfilerWindow::OnSortColumnHeader)
+		+ SHeaderRow::Column(ObjectProfilerColumns::Outer)
+			.DefaultLabel(LOCTEXT("OuterColumn", "Outer"))
+			.FillWidth(0.15f)
+			.SortMode(this, &SObjectProfilerWindow::GetSortModeForColumn, ObjectProfilerColumns::Outer)
 			.OnSort(this, &SObjectProfilerWindow::OnSortColumnHeader);
 
 	ChildSlot
@@ -269,6 +303,179 @@ void SObjectProfilerWindow::Construct(const FArguments& InArgs)
 							]
 						]
 						
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.Padding(ProfilerLayoutConstants::ControlPadding)
+						[
+							SNew(SBox)
+							.MinDesiredWidth(ProfilerLayoutConstants::ButtonMinWidth)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("Startup", "Startup"))
+								.ToolTipText(LOCTEXT("StartupTooltip", "Show objects created per loading phase during engine startup"))
+								.OnClicked(this, &SObjectProfilerWindow::OnShowStartupTimelineClicked)
+								.IsEnabled(this, &SObjectProfilerWindow::HasStartupCapture)
+							]
+						]
+						
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.Padding(ProfilerLayoutConstants::ControlPadding)
+						[
+							SNew(SBox)
+							.MinDesiredWidth(ProfilerLayoutConstants::ButtonMinWidth)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("Largest", "Largest"))
+								.ToolTipText(LOCTEXT("LargestTooltip", "Show the largest individual objects from the last sized collection or a snapshot"))
+								.OnClicked(this, &SObjectProfilerWindow::OnShowLargestObjectsClicked)
+							]
+						]
+						
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.Padding(ProfilerLayoutConstants::ControlPadding)
+						[
+							SNew(SBox)
+							.MinDesiredWidth(ProfilerLayoutConstants::ButtonMinWidth)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("Actors", "Actors"))
+								.ToolTipText(LOCTEXT("ActorsTooltip", "Show the inclusive footprint of each actor class, charging components and subobjects to their owning actor"))
+								.OnClicked(this, &SObjectProfilerWindow::OnShowActorFootprintsClicked)
+							]
+						]
+						
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.Padding(ProfilerLayoutConstants::ControlPadding)
+						[
+							SNew(SBox)
+							.MinDesiredWidth(ProfilerLayoutConstants::ButtonMinWidth)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("Layout", "Layout"))
+								.ToolTipText(LOCTEXT("LayoutTooltip", "Rank heavily instanced classes by alignment padding and allocator rounding waste"))
+								.OnClicked(this, &SObjectProfilerWindow::OnShowLayoutWasteClicked)
+							]
+						]
+						
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.Padding(ProfilerLayoutConstants::ControlPadding)
+						[
+							SNew(SBox)
+							.MinDesiredWidth(ProfilerLayoutConstants::ButtonMinWidth)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("Slack", "Slack"))
+								.ToolTipText(LOCTEXT("SlackTooltip", "Measure unused TArray, TMap and TSet capacity on every instance of the selected class or group, or of all filtered classes"))
+								.OnClicked(this, &SObjectProfilerWindow::OnShowContainerSlackClicked)
+							]
+						]
+						
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.Padding(ProfilerLayoutConstants::ControlPadding)
+						[
+							SNew(SBox)
+							.MinDesiredWidth(ProfilerLayoutConstants::ButtonMinWidth)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("Duplicates", "Duplicates"))
+								.ToolTipText(LOCTEXT("DuplicatesTooltip", "Hash the serialized state of every asset in the selected class, category or group, or of all filtered classes, and list identical copies"))
+								.OnClicked(this, &SObjectProfilerWindow::OnShowDuplicateContentClicked)
+							]
+						]
+						
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.Padding(ProfilerLayoutConstants::ControlPadding)
+						[
+							SNew(SBox)
+							.MinDesiredWidth(ProfilerLayoutConstants::ButtonMinWidth)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("ArchiveSize", "Precise"))
+								.ToolTipText(LOCTEXT("ArchiveSizeTooltip", "Measure instances of the selected class or group, or of all filtered classes, with a memory-counting archive and compare against the resource size estimate"))
+								.OnClicked(this, &SObjectProfilerWindow::OnShowArchiveSizeClicked)
+							]
+						]
+						
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.Padding(ProfilerLayoutConstants::ControlPadding)
+						[
+							SNew(SBox)
+							.MinDesiredWidth(ProfilerLayoutConstants::ButtonMinWidth)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("Reconcile", "Reconcile"))
+								.ToolTipText(LOCTEXT("ReconcileTooltip", "Compare UObject sizes against process memory and Low Level Memory tracker totals"))
+								.OnClicked(this, &SObjectProfilerWindow::OnShowMemoryReconciliationClicked)
+							]
+						]
+						
+						// Counts first
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(ProfilerLayoutConstants::LabelPadding, 0.0f, ProfilerLayoutConstants::ControlPadding, 0.0f)
+						[
+							SNew(SCheckBox)
+							.IsChecked_Lambda([]() { return FObjectProfilerCore::GetCollectionSizing() == ECollectionSizing::Deferred ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+							.OnCheckStateChanged(this, &SObjectProfilerWindow::OnCountsFirstChanged)
+							.ToolTipText(LOCTEXT("CountsFirstTooltip", "Count every class first, then measure sizes in a budgeted second pass starting with the largest classes"))
+							[
+								SNew(STextBlock)
+								.Text(LOCTEXT("CountsFirst", "Counts First"))
+								.Clipping(EWidgetClipping::ClipToBoundsAlways)
+							]
+						]
+						
+						// Exclusive sizes
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(ProfilerLayoutConstants::LabelPadding, 0.0f, ProfilerLayoutConstants::ControlPadding, 0.0f)
+						[
+							SNew(SCheckBox)
+							.IsChecked_Lambda([]() { return FObjectProfilerCore::GetResourceSizeMode() == EResourceSizeMode::Exclusive ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+							.OnCheckStateChanged(this, &SObjectProfilerWindow::OnExclusiveSizesChanged)
+							.ToolTipText(LOCTEXT("ExclusiveSizesTooltip", "Measure only memory each object owns exclusively, without shared resources or render-resource estimates"))
+							[
+								SNew(STextBlock)
+								.Text(LOCTEXT("ExclusiveSizes", "Exclusive Sizes"))
+								.Clipping(EWidgetClipping::ClipToBoundsAlways)
+							]
+						]
+						
+						// Scope
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(ProfilerLayoutConstants::LabelPadding, 0.0f, ProfilerLayoutConstants::ControlPadding, 0.0f)
+						[
+							SNew(STextBlock)
+							.Text(LOCTEXT("Scope", "Scope:"))
+							.Clipping(EWidgetClipping::ClipToBoundsAlways)
+						]
+						
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.MaxWidth(ProfilerLayoutConstants::FilterBoxMaxWidth)
+						.Padding(ProfilerLayoutConstants::ControlPadding)
+						[
+							SNew(SBox)
+							.MinDesiredWidth(ProfilerLayoutConstants::FilterBoxMinWidth)
+							[
+								SAssignNew(ScopeBox, SEditableTextBox)
+								.HintText(LOCTEXT("ScopeHint", "/Game/Maps/Arena, ..."))
+								.ToolTipText(LOCTEXT("ScopeTooltip", "Comma-separated package path prefixes. Refresh and snapshots only walk matching packages."))
+								.OnTextCommitted(this, &SObjectProfilerWindow::OnScopeTextCommitted)
+							]
+						]
+						
 						+ SHorizontalBox::Slot()
 						.FillWidth(1.0f)
 						[
@@ -588,6 +795,27 @@ void SObjectProfilerWindow::Construct(const FArguments& InArgs)
 					.SelectionMode(ESelectionMode::Single)
 				]
 				
+				// Size distribution
+				+ SVerticalBox::Slot()
+				.AutoHeight()
+				[
+					SNew(SExpandableArea)
+					.AreaTitle(LOCTEXT("SizeDistributionTitle", "Size Distribution"))
+					.InitiallyCollapsed(true)
+					.BodyContent()
+					[
+						SNew(SBox)
+						.MaxDesiredHeight(240.0f)
+						[
+							SNew(SScrollBox)
+							+ SScrollBox::Slot()
+							[
+								SAssignNew(SizeDistributionBox, SVerticalBox)
+							]
+						]
+					]
+				]
+				
 				+ SVerticalBox::Slot()
 				.AutoHeight()
 				[
@@ -616,12 +844,15 @@ void SObjectProfilerWindow::Construct(const FArguments& InArgs)
 				SNew(SSnapshotManager)
 				.OnCompareSnapshots(this, &SObjectProfilerWindow::OnCompareSnapshots)
 				.OnViewDelta(this, &SObjectProfilerWindow::OnViewDelta)
+				.OnReplayLoaded(this, &SObjectProfilerWindow::OnReplayLoaded)
+				.Scope_Lambda([this]() { return CollectionScope; })
 			]
 		]
 	];
 
 	RealTimeUpdateHandle = FObjectProfilerCore::OnRealTimeUpdate().AddSP(this, &SObjectProfilerWindow::OnRealTimeUpdate);
 	
+	RebuildSizeDistributionPanel();
 	RefreshDataAsync();
 }
 
@@ -671,11 +902,17 @@ bool SObjectProfilerWindow::HasSelection() const
 	return SelectedTreeItem.IsValid() && SelectedTreeItem->Stats.IsValid();
 }
 
+bool SObjectProfilerWindow::HasStartupCapture() const
+{
+	return FObjectProfilerStartupCapture::HasResults() && !FObjectProfilerStartupCapture::IsCapturing();
+}
+
 TSharedRef<ITableRow> SObjectProfilerWindow::OnGenerateRowForTree(TSharedPtr<FProfilerTreeItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
 {
 	return SNew(SObjectProfilerTreeRow, OwnerTable)
 		.Item(Item)
-		.ViewMode(ViewMode);
+		.ViewMode(ViewMode)
+		.IsProvisional(bShowingProvisional && ViewMode == EProfilerViewMode::Normal);
 }
 
 void SObjectProfilerWindow::OnGetChildrenForTree(TSharedPtr<FProfilerTreeItem> Item, TArray<TSharedPtr<FProfilerTreeItem>>& OutChildren)
@@ -716,9 +953,20 @@ EColumnSortMode::Type SObjectProfilerWindow::GetSortModeForColumn(FName ColumnId
 
 void SObjectProfilerWindow::SortData()
 {
+	FScopedProfilerCost Cost(EProfilerCostBucket::UserInterface);
 	const bool bAscending = (CurrentSortMode == EColumnSortMode::Ascending);
+	
+	TMap<const FObjectClassStats*, FString> OuterLabels;
+	if (CurrentSortColumn == ObjectProfilerColumns::Outer)
+	{
+		OuterLabels.Reserve(FilteredStats.Num());
+		for (const TSharedPtr<FObjectClassStats>& Stats : FilteredStats)
+		{
+			OuterLabels.Add(Stats.Get(), Stats->OuterStats.Num() > 0 ? FObjectProfilerCore::GetOwnerLabel(FObjectClassStats::FindDominantOwner(Stats->OuterStats)) : FString());
+		}
+	}
 
-	FilteredStats.Sort([this, bAscending](const TSharedPtr<FObjectClassStats>& A, const TSharedPtr<FObjectClassStats>& B)
+	FilteredStats.Sort([this, bAscending, &OuterLabels](const TSharedPtr<FObjectClassStats>& A, const TSharedPtr<FObjectClassStats>& B)
 	{
 		int32 Result = 0;
 
@@ -758,6 +1006,14 @@ void SObjectProfilerWindow::SortData()
 		{
 			Result = static_cast<int32>(A->Category) - static_cast<int32>(B->Category);
 		}
+		else if (CurrentSortColumn == ObjectProfilerColumns::Package)
+		{
+			Result = FObjectClassStats::FindDominantOwner(A->PackageStats).Compare(FObjectClassStats::FindDominantOwner(B->PackageStats));
+		}
+		else if (CurrentSortColumn == ObjectProfilerColumns::Outer)
+		{
+			Result = OuterLabels.FindChecked(A.Get()).Compare(OuterLabels.FindChecked(B.Get()));
+		}
 
 		return bAscending ? (Result < 0) : (Result > 0);
 	});
@@ -889,6 +1145,182 @@ FReply SObjectProfilerWindow::OnShowReferencesClicked()
 	return FReply::Handled();
 }
 
+FReply SObjectProfilerWindow::OnShowStartupTimelineClicked()
+{
+	TSharedRef<SWindow> StartupWindow = SNew(SWindow)
+		.Title(LOCTEXT("StartupWindowTitle", "Startup Object Timeline"))
+		.ClientSize(FVector2D(1000, 700))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SStartupTimelineWindow)
+		];
+
+	FSlateApplication::Get().AddWindow(StartupWindow);
+	
+	return FReply::Handled();
+}
+
+FReply SObjectProfilerWindow::OnShowLargestObjectsClicked()
+{
+	TSharedRef<SWindow> LargestWindow = SNew(SWindow)
+		.Title(LOCTEXT("LargestWindowTitle", "Largest Objects"))
+		.ClientSize(FVector2D(1100, 600))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SLargestObjectsPanel)
+		];
+
+	FSlateApplication::Get().AddWindow(LargestWindow);
+	
+	return FReply::Handled();
+}
+
+FReply SObjectProfilerWindow::OnShowActorFootprintsClicked()
+{
+	TSharedRef<SWindow> FootprintWindow = SNew(SWindow)
+		.Title(LOCTEXT("FootprintWindowTitle", "Actor Footprints"))
+		.ClientSize(FVector2D(1100, 600))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SActorFootprintPanel)
+		];
+
+	FSlateApplication::Get().AddWindow(FootprintWindow);
+	
+	return FReply::Handled();
+}
+
+FReply SObjectProfilerWindow::OnShowLayoutWasteClicked()
+{
+	TSharedRef<SWindow> LayoutWindow = SNew(SWindow)
+		.Title(LOCTEXT("LayoutWindowTitle", "Class Layout Waste"))
+		.ClientSize(FVector2D(1000, 650))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SLayoutWastePanel)
+			.Stats(AllStats)
+		];
+
+	FSlateApplication::Get().AddWindow(LayoutWindow);
+	
+	return FReply::Handled();
+}
+
+TArray<TSharedPtr<FObjectClassStats>> SObjectProfilerWindow::GatherScopeStats() const
+{
+	TArray<TSharedPtr<FObjectClassStats>> ScopeStats;
+	
+	TFunction<void(const TSharedPtr<FProfilerTreeItem>&)> GatherStats = [&ScopeStats, &GatherStats](const TSharedPtr<FProfilerTreeItem>& Item)
+	{
+		if (Item->Stats.IsValid() && Item->Stats->GetClass())
+		{
+			ScopeStats.AddUnique(Item->Stats);
+		}
+		for (const TSharedPtr<FProfilerTreeItem>& Child : Item->Children)
+		{
+			GatherStats(Child);
+		}
+	};
+	
+	if (SelectedTreeItem.IsValid())
+	{
+		GatherStats(SelectedTreeItem);
+	}
+	else
+	{
+		for (const TSharedPtr<FObjectClassStats>& Stats : FilteredStats)
+		{
+			if (Stats->GetClass())
+			{
+				ScopeStats.Add(Stats);
+			}
+		}
+	}
+	
+	return ScopeStats;
+}
+
+TArray<UClass*> SObjectProfilerWindow::GatherScopeClasses() const
+{
+	TArray<UClass*> Classes;
+	for (const TSharedPtr<FObjectClassStats>& Stats : GatherScopeStats())
+	{
+		Classes.AddUnique(Stats->GetClass());
+	}
+	return Classes;
+}
+
+FReply SObjectProfilerWindow::OnShowContainerSlackClicked()
+{
+	TSharedRef<SWindow> SlackWindow = SNew(SWindow)
+		.Title(LOCTEXT("SlackWindowTitle", "Container Slack"))
+		.ClientSize(FVector2D(1000, 650))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SContainerSlackPanel)
+			.Classes(GatherScopeClasses())
+		];
+
+	FSlateApplication::Get().AddWindow(SlackWindow);
+	
+	return FReply::Handled();
+}
+
+FReply SObjectProfilerWindow::OnShowDuplicateContentClicked()
+{
+	TSharedRef<SWindow> DuplicateWindow = SNew(SWindow)
+		.Title(LOCTEXT("DuplicatesWindowTitle", "Duplicate Content"))
+		.ClientSize(FVector2D(1000, 650))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SDuplicateContentPanel)
+			.Classes(GatherScopeClasses())
+		];
+
+	FSlateApplication::Get().AddWindow(DuplicateWindow);
+	
+	return FReply::Handled();
+}
+
+FReply SObjectProfilerWindow::OnShowArchiveSizeClicked()
+{
+	TSharedRef<SWindow> ArchiveSizeWindow = SNew(SWindow)
+		.Title(LOCTEXT("ArchiveSizeWindowTitle", "Precise Size"))
+		.ClientSize(FVector2D(1000, 650))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SArchiveSizePanel)
+			.Stats(GatherScopeStats())
+		];
+
+	FSlateApplication::Get().AddWindow(ArchiveSizeWindow);
+	
+	return FReply::Handled();
+}
+
+FReply SObjectProfilerWindow::OnShowMemoryReconciliationClicked()
+{
+	TSharedRef<SWindow> ReconciliationWindow = SNew(SWindow)
+		.Title(LOCTEXT("ReconciliationWindowTitle", "Memory Reconciliation"))
+		.ClientSize(FVector2D(700, 600))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SMemoryReconciliationPanel)
+		];
+
+	FSlateApplication::Get().AddWindow(ReconciliationWindow);
+	
+	return FReply::Handled();
+}
+
 void SObjectProfilerWindow::OnFilterTextChanged(const FText& NewText)
 {
 	FilterSettings.TextFilter = NewText.ToString();
@@ -899,6 +1331,27 @@ void SObjectProfilerWindow::OnFilterTextChanged(const FText& NewText)
 	UpdateStatusBar();
 }
 
+void SObjectProfilerWindow::OnScopeTextCommitted(const FText& NewText, ETextCommit::Type CommitType)
+{
+	TArray<FString> Prefixes;
+	NewText.ToString().ParseIntoArray(Prefixes, TEXT(","), true);
+	
+	CollectionScope.PackagePrefixes.Reset();
+	for (FString& Prefix : Prefixes)
+	{
+		Prefix.TrimStartAndEndInline();
+		if (!Prefix.IsEmpty())
+		{
+			CollectionScope.PackagePrefixes.Add(Prefix);
+		}
+	}
+	
+	if (CommitType == ETextCommit::OnEnter && ViewMode == EProfilerViewMode::Normal)
+	{
+		RefreshDataAsync();
+	}
+}
+
 void SObjectProfilerWindow::OnTreeDoubleClick(TSharedPtr<FProfilerTreeItem> Item)
 {
 	if (!Item.IsValid())
@@ -921,14 +1374,50 @@ void SObjectProfilerWindow::OnTreeDoubleClick(TSharedPtr<FProfilerTreeItem> Item
 	TSharedRef<SVerticalBox> ListBox = SNew(SVerticalBox);
 	for (const FString& Instance : Instances)
 	{
+		FString InstancePath = Instance;
+		int32 PipeIndex;
+		if (Instance.FindChar(TEXT('|'), PipeIndex))
+		{
+			InstancePath = Instance.Left(PipeIndex).TrimEnd();
+		}
+		
 		ListBox->AddSlot()
 		.AutoHeight()
 		.Padding(2.0f)
 		[
-			SNew(STextBlock)
-			.Text(FText::FromString(Instance))
-			.AutoWrapText(true)
-			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Instance))
+				.AutoWrapText(true)
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(ProfilerLayoutConstants::ControlPadding, 0.0f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("InspectInstance", "Inspect"))
+				.ToolTipText(LOCTEXT("InspectInstanceTooltip", "Break this instance's memory down by reflected property"))
+				.OnClicked_Lambda([InstancePath]()
+				{
+					TSharedRef<SWindow> BreakdownWindow = SNew(SWindow)
+						.Title(FText::Format(LOCTEXT("BreakdownWindowTitle", "Property Memory: {0}"), FText::FromString(InstancePath)))
+						.ClientSize(FVector2D(1000, 650))
+						.SupportsMinimize(true)
+						.SupportsMaximize(true)
+						[
+							SNew(SPropertyBreakdownPanel)
+							.ObjectPath(InstancePath)
+						];
+
+					FSlateApplication::Get().AddWindow(BreakdownWindow);
+					return FReply::Handled();
+				})
+			]
 		];
 	}
 
@@ -968,6 +1457,230 @@ void SObjectProfilerWindow::OnTreeDoubleClick(TSharedPtr<FProfilerTreeItem> Item
 void SObjectProfilerWindow::OnTreeSelectionChanged(TSharedPtr<FProfilerTreeItem> Item, ESelectInfo::Type SelectInfo)
 {
 	SelectedTreeItem = Item;
+	RebuildSizeDistributionPanel();
+}
+
+void SObjectProfilerWindow::RebuildSizeDistributionPanel()
+{
+	SizeDistributionBox->ClearChildren();
+	
+	auto AddLine = [this](const FText& Text)
+	{
+		SizeDistributionBox->AddSlot()
+		.AutoHeight()
+		.Padding(4.0f, 2.0f)
+		[
+			SNew(STextBlock)
+			.Text(Text)
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		];
+	};
+	
+	if (!SelectedTreeItem.IsValid())
+	{
+		AddLine(LOCTEXT("SizeDistributionNoSelection", "Select a class to see how its instance sizes are distributed."));
+		return;
+	}
+	
+	auto FormatKind = [](int64 Bytes, int64 DeltaBytes)
+	{
+		if (DeltaBytes == 0)
+		{
+			return FText::FromString(FObjectProfilerCore::FormatBytes(Bytes));
+		}
+		return FText::FromString(FString::Printf(TEXT("%s (%s%s)"),
+			*FObjectProfilerCore::FormatBytes(Bytes),
+			DeltaBytes > 0 ? TEXT("+") : TEXT("-"),
+			*FObjectProfilerCore::FormatBytes(FMath::Abs(DeltaBytes))));
+	};
+	
+	const FObjectSizeBreakdown Breakdown = SelectedTreeItem->GetAggregatedSizeBreakdown();
+	const FObjectSizeBreakdown DeltaBreakdown = SelectedTreeItem->GetAggregatedSizeBreakdown(true);
+	
+	AddLine(FText::Format(LOCTEXT("SizeBreakdownSummary", "{0} ({1}): system {2} | video {3} | unknown {4}"),
+		FText::FromString(SelectedTreeItem->Stats.IsValid() ? SelectedTreeItem->Stats->ClassName : SelectedTreeItem->DisplayName),
+		FObjectProfilerCore::GetResourceSizeMode() == EResourceSizeMode::Exclusive ? LOCTEXT("SizeModeExclusive", "exclusive") : LOCTEXT("SizeModeEstimatedTotal", "estimated total"),
+		FormatKind(Breakdown.SystemBytes, DeltaBreakdown.SystemBytes),
+		FormatKind(Breakdown.VideoBytes, DeltaBreakdown.VideoBytes),
+		FormatKind(Breakdown.UnknownBytes, DeltaBreakdown.UnknownBytes)));
+	
+	if (!SelectedTreeItem->Stats.IsValid())
+	{
+		return;
+	}
+	
+	const FObjectClassStats& Stats = *SelectedTreeItem->Stats;
+	
+	if (ActiveReplay.IsValid())
+	{
+		const TArray<FObjectHistoryPoint> Curve = ActiveReplay->GetClassCountOverTime(Stats.ClassName, 0.0, ActiveReplay->GetDuration(), ProfilerLayoutConstants::ReplayCurvePoints);
+		if (Curve.Num() > 0)
+		{
+			int32 PeakCount = 0;
+			for (const FObjectHistoryPoint& Point : Curve)
+			{
+				PeakCount = FMath::Max(PeakCount, Point.InstanceCount);
+			}
+			
+			AddLine(FText::Format(LOCTEXT("ReplayCountSummary", "{0} over the replay: start {1} | peak {2} | end {3}"),
+				FText::FromString(Stats.ClassName),
+				FText::AsNumber(Curve[0].InstanceCount),
+				FText::AsNumber(PeakCount),
+				FText::AsNumber(Curve.Last().InstanceCount)));
+			
+			TSharedPtr<SSparkline> CurveWidget;
+			SizeDistributionBox->AddSlot()
+			.AutoHeight()
+			.Padding(4.0f, 2.0f)
+			[
+				SNew(SBox)
+				.HeightOverride(ProfilerLayoutConstants::ReplayCurveHeight)
+				[
+					SAssignNew(CurveWidget, SSparkline)
+					.LineColor(FLinearColor(0.3f, 0.7f, 1.0f))
+					.FillColor(FLinearColor(0.3f, 0.7f, 1.0f, 0.2f))
+				]
+			];
+			CurveWidget->SetValuesFromHistory(Curve, true);
+		}
+	}
+	
+	const FObjectFlagCensus& Census = Stats.FlagCensus;
+	
+	FFormatNamedArguments FlagArgs;
+	FlagArgs.Add(TEXT("Rooted"), FText::AsNumber(Census.RootSet));
+	FlagArgs.Add(TEXT("Transient"), FText::AsNumber(Census.Transient));
+	FlagArgs.Add(TEXT("TransientPackage"), FText::AsNumber(Census.TransientPackage));
+	FlagArgs.Add(TEXT("Garbage"), FText::AsNumber(Census.Garbage));
+	FlagArgs.Add(TEXT("Loading"), FText::AsNumber(Census.AsyncLoading));
+	FlagArgs.Add(TEXT("Standalone"), FText::AsNumber(Census.Standalone));
+	FlagArgs.Add(TEXT("Public"), FText::AsNumber(Census.Public));
+	AddLine(FText::Format(LOCTEXT("FlagCensusSummary", "Flags: rooted {Rooted} | transient {Transient} | in transient package {TransientPackage} | garbage {Garbage} | loading {Loading} | standalone {Standalone} | public {Public}"), FlagArgs));
+	
+	if (Stats.bIsRetentionLeaking)
+	{
+		AddLine(FText::Format(LOCTEXT("RetentionLeakWarning", "Rooted and transient-package instances have grown for {0} refreshes in a row."),
+			FText::AsNumber(Stats.ConsecutiveRetentionGrowthTicks)));
+	}
+	
+	const FObjectSizeDistribution& Distribution = Stats.SizeDistribution;
+	const int32 SampleCount = Distribution.GetSampleCount();
+	
+	if (SampleCount == 0)
+	{
+		AddLine(FText::Format(LOCTEXT("SizeDistributionEmpty", "No measured instances of {0}."), FText::FromString(Stats.ClassName)));
+		return;
+	}
+	
+	AddLine(FText::Format(LOCTEXT("SizeDistributionSummary", "{0}: {1} measured | p50 {2} | p95 {3} | max {4}"),
+		FText::FromString(Stats.ClassName),
+		FText::AsNumber(SampleCount),
+		FText::FromString(FObjectProfilerCore::FormatBytes(Distribution.GetPercentile(0.5f))),
+		FText::FromString(FObjectProfilerCore::FormatBytes(Distribution.GetPercentile(0.95f))),
+		FText::FromString(FObjectProfilerCore::FormatBytes(Distribution.MaxSizeBytes))));
+	
+	int32 MaxBucketCount = 1;
+	for (int32 Count : Distribution.BucketCounts)
+	{
+		MaxBucketCount = FMath::Max(MaxBucketCount, Count);
+	}
+	
+	for (int32 BucketIndex = 0; BucketIndex < FObjectSizeDistribution::NumBuckets; ++BucketIndex)
+	{
+		const int32 Count = Distribution.BucketCounts[BucketIndex];
+		if (Count <= 0)
+		{
+			continue;
+		}
+		
+		const FString RangeLabel = FString::Printf(TEXT("%s - %s"),
+			*FObjectProfilerCore::FormatBytes(FObjectSizeDistribution::GetBucketLowerBound(BucketIndex)),
+			*FObjectProfilerCore::FormatBytes(FObjectSizeDistribution::GetBucketUpperBound(BucketIndex)));
+		
+		SizeDistributionBox->AddSlot()
+		.AutoHeight()
+		.Padding(4.0f, 1.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SBox)
+				.WidthOverride(170.0f)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(RangeLabel))
+					.Clipping(EWidgetClipping::ClipToBoundsAlways)
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SBox)
+				.HeightOverride(10.0f)
+				[
+					SNew(SProgressBar)
+					.Percent(static_cast<float>(Count) / MaxBucketCount)
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(6.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(SBox)
+				.WidthOverride(70.0f)
+				[
+					SNew(STextBlock)
+					.Text(FText::AsNumber(Count))
+					.Clipping(EWidgetClipping::ClipToBoundsAlways)
+				]
+			]
+		];
+	}
+	
+	AddLine(LOCTEXT("SizeDistributionLargest", "Largest instances:"));
+	
+	for (const FObjectSizeSample& Sample : Distribution.GetLargestSorted())
+	{
+		SizeDistributionBox->AddSlot()
+		.AutoHeight()
+		.Padding(4.0f, 1.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SBox)
+				.WidthOverride(90.0f)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(FObjectProfilerCore::FormatBytes(Sample.SizeBytes)))
+					.Clipping(EWidgetClipping::ClipToBoundsAlways)
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SHyperlink)
+				.Text(FText::FromString(Sample.ObjectPath))
+				.ToolTipText(LOCTEXT("NavigateToObjectTooltip", "Select this object in the level or sync the Content Browser to its asset"))
+				.OnNavigate(FSimpleDelegate::CreateSP(this, &SObjectProfilerWindow::NavigateToObject, Sample.ObjectPath))
+			]
+		];
+	}
+}
+
+void SObjectProfilerWindow::NavigateToObject(FString ObjectPath)
+{
+	if (!FObjectProfilerCore::FocusObjectInEditor(ObjectPath))
+	{
+		StatusText->SetText(FText::Format(LOCTEXT("NavigateObjectGone", "{0} is no longer loaded."), FText::FromString(ObjectPath)));
+	}
 }
 
 void SObjectProfilerWindow::OnViewModeChanged(TSharedPtr<FString> NewMode, ESelectInfo::Type SelectInfo)
@@ -978,6 +1691,7 @@ void SObjectProfilerWindow::OnViewModeChanged(TSharedPtr<FString> NewMode, ESele
 	}
 	
 	CurrentViewMode = NewMode;
+	ActiveReplay.Reset();
 	
 	if (*NewMode == TEXT("Normal"))
 	{
@@ -1030,17 +1744,43 @@ void SObjectProfilerWindow::OnGroupModeChanged(TSharedPtr<FString> NewMode, ESel
 	
 	CurrentGroupMode = NewMode;
 	
-	if (*NewMode == TEXT("None"))
-	{
-		GroupMode = EProfilerGroupMode::None;
-	}
-	else if (*NewMode == TEXT("By Module"))
-	{
-		GroupMode = EProfilerGroupMode::ByModule;
-	}
-	else if (*NewMode == TEXT("By Category"))
+	GroupLevels.Reset();
+	
+	TArray<FString> LevelNames;
+	NewMode->ParseIntoArray(LevelNames, TEXT(" > "));
+	
+	for (FString LevelName : LevelNames)
 	{
-		GroupMode = EProfilerGroupMode::ByCategory;
+		LevelName.RemoveFromStart(TEXT("By "));
+		
+		if (LevelName == TEXT("Source"))
+		{
+			GroupLevels.Add(EProfilerGroupMode::BySource);
+		}
+		else if (LevelName == TEXT("Module"))
+		{
+			GroupLevels.Add(EProfilerGroupMode::ByModule);
+		}
+		else if (LevelName == TEXT("Category"))
+		{
+			GroupLevels.Add(EProfilerGroupMode::ByCategory);
+		}
+		else if (LevelName == TEXT("Package"))
+		{
+			GroupLevels.Add(EProfilerGroupMode::ByPackage);
+		}
+		else if (LevelName == TEXT("Outer"))
+		{
+			GroupLevels.Add(EProfilerGroupMode::ByOuter);
+		}
+		else if (LevelName == TEXT("World"))
+		{
+			GroupLevels.Add(EProfilerGroupMode::ByWorld);
+		}
+		else if (LevelName == TEXT("Class Hierarchy"))
+		{
+			GroupLevels.Add(EProfilerGroupMode::ByClassHierarchy);
+		}
 	}
 	
 	RebuildTreeView();
@@ -1182,6 +1922,16 @@ void SObjectProfilerWindow::OnShowOnlyLeakingChanged(ECheckBoxState NewState)
 	UpdateStatusBar();
 }
 
+void SObjectProfilerWindow::OnCountsFirstChanged(ECheckBoxState NewState)
+{
+	FObjectProfilerCore::SetCollectionSizing(NewState == ECheckBoxState::Checked ? ECollectionSizing::Deferred : ECollectionSizing::Inline);
+}
+
+void SObjectProfilerWindow::OnExclusiveSizesChanged(ECheckBoxState NewState)
+{
+	FObjectProfilerCore::SetResourceSizeMode(NewState == ECheckBoxState::Checked ? EResourceSizeMode::Exclusive : EResourceSizeMode::EstimatedTotal);
+}
+
 void SObjectProfilerWindow::OnShowOnlyHotChanged(ECheckBoxState NewState)
 {
 	FilterSettings.bShowOnlyHot = (NewState == ECheckBoxState::Checked);
@@ -1205,13 +1955,17 @@ void SObjectProfilerWindow::RefreshDataAsync()
 	FObjectProfilerCore::CollectObjectStatsAsync(
 		5,
 		FOnObjectStatsCollected::CreateSP(this, &SObjectProfilerWindow::OnAsyncCollectionComplete),
-		FOnCollectionProgress::CreateSP(this, &SObjectProfilerWindow::OnAsyncCollectionProgress)
+		FOnCollectionProgress::CreateSP(this, &SObjectProfilerWindow::OnAsyncCollectionProgress),
+		CollectionScope,
+		FOnPartialResults::CreateSP(this, &SObjectProfilerWindow::OnAsyncCollectionPartial)
 	);
 }
 
 void SObjectProfilerWindow::OnAsyncCollectionComplete(TArray<TSharedPtr<FObjectClassStats>> Results)
 {
 	CurrentProgress = 1.0f;
+	bShowingProvisional = false;
+	ActiveReplay.Reset();
 	AllStats = MoveTemp(Results);
 	ApplyFilter();
 	SortData();
@@ -1228,6 +1982,24 @@ void SObjectProfilerWindow::OnAsyncCollectionProgress(float Progress)
 	StatusText->SetText(FText::Format(LOCTEXT("StatusLoadingProgress", "Loading... {0}%"), FText::AsNumber(Percent)));
 }
 
+void SObjectProfilerWindow::OnAsyncCollectionPartial(const TArray<TSharedPtr<FObjectClassStats>>& Results, float Progress)
+{
+	if (ViewMode != EProfilerViewMode::Normal)
+	{
+		return;
+	}
+	
+	CurrentProgress = Progress;
+	bShowingProvisional = true;
+	ActiveReplay.Reset();
+	AllStats = Results;
+	ApplyFilter();
+	SortData();
+	RebuildTreeView();
+	TreeView->RequestTreeRefresh();
+	UpdateStatusBar();
+}
+
 void SObjectProfilerWindow::OnRealTimeUpdate(const TArray<TSharedPtr<FObjectClassStats>>& Results)
 {
 	if (ViewMode != EProfilerViewMode::RealTime)
@@ -1235,6 +2007,7 @@ void SObjectProfilerWindow::OnRealTimeUpdate(const TArray<TSharedPtr<FObjectClas
 		return;
 	}
 	
+	ActiveReplay.Reset();
 	AllStats = Results;
 	ApplyFilter();
 	SortData();
@@ -1249,6 +2022,7 @@ void SObjectProfilerWindow::OnCompareSnapshots(int32 IndexA, int32 IndexB)
 	CurrentViewMode = ViewModeOptions[1];
 	ViewModeCombo->SetSelectedItem(CurrentViewMode);
 	
+	ActiveReplay.Reset();
 	AllStats = FObjectProfilerCore::CompareTwoSnapshots(IndexA, IndexB);
 	ApplyFilter();
 	SortData();
@@ -1273,6 +2047,7 @@ void SObjectProfilerWindow::OnViewDelta(int32 SnapshotIndex)
 	CurrentViewMode = ViewModeOptions[1];
 	ViewModeCombo->SetSelectedItem(CurrentViewMode);
 	
+	ActiveReplay.Reset();
 	AllStats = FObjectProfilerCore::GetDeltaSinceSnapshot(SnapshotIndex);
 	ApplyFilter();
 	SortData();
@@ -1281,8 +2056,31 @@ void SObjectProfilerWindow::OnViewDelta(int32 SnapshotIndex)
 	UpdateStatusBar();
 }
 
+void SObjectProfilerWindow::OnReplayLoaded(TSharedRef<FObjectEventReplay> Replay)
+{
+	FObjectProfilerCore::StopRealTimeMonitoring();
+	ViewMode = EProfilerViewMode::Delta;
+	CurrentViewMode = ViewModeOptions[1];
+	ViewModeCombo->SetSelectedItem(CurrentViewMode);
+	
+	ActiveReplay = Replay;
+	AllStats = Replay->Diff(0.0, Replay->GetDuration());
+	FObjectProfilerCore::ComputeHierarchyRollups(AllStats);
+	ApplyFilter();
+	SortData();
+	RebuildTreeView();
+	TreeView->RequestTreeRefresh();
+	
+	StatusText->SetText(FText::Format(
+		LOCTEXT("StatusReplay", "Replay: {0} events over {1}s | Classes changed: {2}"),
+		FText::AsNumber(Replay->GetNumEvents()),
+		FText::AsNumber(FMath::RoundToInt(Replay->GetDuration())),
+		FText::AsNumber(FilteredStats.Num())));
+}
+
 void SObjectProfilerWindow::ApplyFilter()
 {
+	FScopedProfilerCost Cost(EProfilerCostBucket::UserInterface);
 	FilteredStats.Empty();
 
 	for (const auto& Stats : AllStats)
@@ -1372,7 +2170,8 @@ void SObjectProfilerWindow::ApplyFilter()
 
 void SObjectProfilerWindow::RebuildTreeView()
 {
-	TreeItems = FObjectProfilerCore::BuildTreeView(FilteredStats, GroupMode);
+	FScopedProfilerCost Cost(EProfilerCostBucket::UserInterface);
+	TreeItems = FObjectProfilerCore::BuildTreeView(FilteredStats, GroupLevels);
 }
 
 void SObjectProfilerWindow::UpdateStatusBar()
@@ -1400,13 +2199,26 @@ void SObjectProfilerWindow::UpdateStatusBar()
 	else if (ViewMode == EProfilerViewMode::RealTime)
 	{
 		StatusStr = FString::Printf(TEXT("Real-Time (%.1fs) | Classes: %d | Objects: %d | Size: %s"),
-			FObjectProfilerCore::GetRealTimeInterval(),
+			FObjectProfilerCore::GetRealTimeInterval() * FObjectProfilerGovernor::GetIntervalScale(),
 			FilteredStats.Num(), TotalObjects, *FObjectProfilerCore::FormatBytes(TotalSize));
 	}
 	else
 	{
 		StatusStr = FString::Printf(TEXT("Classes: %d | Objects: %d | Size: %s"),
 			FilteredStats.Num(), TotalObjects, *FObjectProfilerCore::FormatBytes(TotalSize));
+		
+		if (bShowingProvisional)
+		{
+			const bool bSizing = FilteredStats.ContainsByPredicate([](const TSharedPtr<FObjectClassStats>& Stats) { return Stats->bSizePending; });
+			StatusStr = FString::Printf(TEXT("%s (%d%%) | %s"),
+				bSizing ? TEXT("Sizing") : TEXT("Provisional"),
+				FMath::RoundToInt(CurrentProgress * 100.0f), *StatusStr);
+		}
+		
+		if (!CollectionScope.IsEmpty())
+		{
+			StatusStr += FString::Printf(TEXT(" | Scope: %s"), *FObjectProfilerCore::DescribeScope(CollectionScope));
+		}
 	}
 	
 	if (LeakingCount > 0)
@@ -1423,6 +2235,15 @@ void SObjectProfilerWindow::UpdateStatusBar()
 	{
 		StatusStr += TEXT(" | Filtered");
 	}
+	
+	if (FObjectProfilerGovernor::GetThrottleLevel() > 0 || ViewMode == EProfilerViewMode::RealTime)
+	{
+		const FString GovernorStatus = FObjectProfilerGovernor::GetStatusText();
+		if (!GovernorStatus.IsEmpty())
+		{
+			StatusStr += TEXT(" | ") + GovernorStatus;
+		}
+	}
 
 	StatusText->SetText(FText::FromString(StatusStr));
 }
@@ -1550,6 +2371,7 @@ void SObjectProfilerTreeRow::Construct(const FArguments& InArgs, const TSharedRe
 {
 	Item = InArgs._Item;
 	ViewMode = InArgs._ViewMode;
+	bIsProvisional = InArgs._IsProvisional;
 	SMultiColumnTableRow<TSharedPtr<FProfilerTreeItem>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
 }
 
@@ -1596,6 +2418,11 @@ TSharedRef<SWidget> SObjectProfilerTreeRow::GenerateWidgetForColumn(const FName&
 			DisplayName = FString::Printf(TEXT("%s (%d)"), *Item->DisplayName, Item->Children.Num());
 		}
 		
+		if (bIsProvisional)
+		{
+			TextColor.A = 0.6f;
+		}
+		
 		return SNew(SBox)
 			.Clipping(EWidgetClipping::ClipToBoundsAlways)
 			[
@@ -1643,16 +2470,18 @@ TSharedRef<SWidget> SObjectProfilerTreeRow::GenerateWidgetForColumn(const FName&
 
 	if (ColumnName == ObjectProfilerColumns::InstanceCount)
 	{
+		const int32 DisplayCount = Item->GetAggregatedInstanceCount();
+		
 		FSlateColor TextColor = FSlateColor(FLinearColor::White);
-		if (Stats->InstanceCount > 10000)
+		if (DisplayCount > 10000)
 		{
 			TextColor = FSlateColor(FLinearColor(1.0f, 0.3f, 0.3f));
 		}
-		else if (Stats->InstanceCount > 1000)
+		else if (DisplayCount > 1000)
 		{
 			TextColor = FSlateColor(FLinearColor(1.0f, 0.7f, 0.3f));
 		}
-		else if (Stats->InstanceCount > 100)
+		else if (DisplayCount > 100)
 		{
 			TextColor = FSlateColor(FLinearColor(1.0f, 1.0f, 0.3f));
 		}
@@ -1661,7 +2490,9 @@ TSharedRef<SWidget> SObjectProfilerTreeRow::GenerateWidgetForColumn(const FName&
 			.Clipping(EWidgetClipping::ClipToBoundsAlways)
 			[
 				SNew(STextBlock)
-				.Text(FText::AsNumber(Stats->InstanceCount))
+				.Text(Item->bInclusiveTotals
+					? FText::Format(LOCTEXT("InclusiveInstanceCount", "{0} (self {1})"), FText::AsNumber(DisplayCount), FText::AsNumber(Stats->InstanceCount))
+					: FText::AsNumber(DisplayCount))
 				.ColorAndOpacity(TextColor)
 				.Margin(FMargin(4.0f, 2.0f))
 				.Clipping(EWidgetClipping::ClipToBoundsAlways)
@@ -1671,15 +2502,16 @@ TSharedRef<SWidget> SObjectProfilerTreeRow::GenerateWidgetForColumn(const FName&
 	{
 		FSlateColor TextColor = FSlateColor(FLinearColor::White);
 		FString DeltaText;
+		const int32 DisplayDelta = Item->bInclusiveTotals ? Stats->InclusiveDeltaCount : Stats->DeltaCount;
 		
-		if (Stats->DeltaCount > 0)
+		if (DisplayDelta > 0)
 		{
-			DeltaText = FString::Printf(TEXT("+%d"), Stats->DeltaCount);
+			DeltaText = FString::Printf(TEXT("+%d"), DisplayDelta);
 			TextColor = FSlateColor(FLinearColor(0.3f, 1.0f, 0.3f));
 		}
-		else if (Stats->DeltaCount < 0)
+		else if (DisplayDelta < 0)
 		{
-			DeltaText = FString::Printf(TEXT("%d"), Stats->DeltaCount);
+			DeltaText = FString::Printf(TEXT("%d"), DisplayDelta);
 			TextColor = FSlateColor(FLinearColor(1.0f, 0.3f, 0.3f));
 		}
 		else
@@ -1725,9 +2557,11 @@ TSharedRef<SWidget> SObjectProfilerTreeRow::GenerateWidgetForColumn(const FName&
 	}
 	else if (ColumnName == ObjectProfilerColumns::TotalSize)
 	{
-		FString SizeText = Stats->bSizeAvailable 
-			? FObjectProfilerCore::FormatBytes(Stats->TotalSizeBytes)
-			: TEXT("N/A");
+		FString SizeText = Stats->bSizePending
+			? TEXT("...")
+			: (Stats->bSizeAvailable || Item->bInclusiveTotals)
+				? FObjectProfilerCore::FormatBytes(Item->GetAggregatedSize())
+				: TEXT("N/A");
 			
 		return SNew(SBox)
 			.Clipping(EWidgetClipping::ClipToBoundsAlways)
@@ -1740,9 +2574,11 @@ TSharedRef<SWidget> SObjectProfilerTreeRow::GenerateWidgetForColumn(const FName&
 	}
 	else if (ColumnName == ObjectProfilerColumns::AvgSize)
 	{
-		FString SizeText = Stats->bSizeAvailable 
-			? FObjectProfilerCore::FormatBytes(Stats->AverageSizeBytes)
-			: TEXT("N/A");
+		FString SizeText = Stats->bSizePending
+			? TEXT("...")
+			: Stats->bSizeAvailable 
+				? FObjectProfilerCore::FormatBytes(Stats->AverageSizeBytes)
+				: TEXT("N/A");
 			
 		return SNew(SBox)
 			.Clipping(EWidgetClipping::ClipToBoundsAlways)
@@ -1870,6 +2706,33 @@ TSharedRef<SWidget> SObjectProfilerTreeRow::GenerateWidgetForColumn(const FName&
 				.Clipping(EWidgetClipping::ClipToBoundsAlways)
 			];
 	}
+	else if (ColumnName == ObjectProfilerColumns::Package || ColumnName == ObjectProfilerColumns::Outer)
+	{
+		const bool bPackage = ColumnName == ObjectProfilerColumns::Package;
+		const int32 NumOwners = bPackage ? Stats->PackageStats.Num() : Stats->OuterStats.Num();
+		
+		FString OwnerText;
+		if (NumOwners > 0)
+		{
+			const FString DominantOwner = bPackage
+				? FObjectProfilerCore::GetOwnerLabel(FObjectClassStats::FindDominantOwner(Stats->PackageStats))
+				: FObjectProfilerCore::GetOwnerLabel(FObjectClassStats::FindDominantOwner(Stats->OuterStats));
+			OwnerText = NumOwners > 1
+				? FString::Printf(TEXT("%s (+%d)"), *DominantOwner, NumOwners - 1)
+				: DominantOwner;
+		}
+		
+		return SNew(SBox)
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(OwnerText))
+				.ToolTipText(FText::FromString(OwnerText))
+				.ColorAndOpacity(FSlateColor(FLinearColor(0.7f, 0.7f, 0.7f)))
+				.Margin(FMargin(4.0f, 2.0f))
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			];
+	}
 
 	return SNullWidget::NullWidget;
 }
@@ -0,0 +1,208 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "SPropertyBreakdownPanel.h"
+#include "ObjectProfilerCore.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SExpanderArrow.h"
+
+#define LOCTEXT_NAMESPACE "ObjectProfiler"
+
+namespace PropertyBreakdownColumns
+{
+	static const FName Property("Property");
+	static const FName Type("Type");
+	static const FName Total("Total");
+	static const FName Heap("Heap");
+	static const FName Share("Share");
+}
+
+namespace PropertyBreakdownLayoutConstants
+{
+	constexpr float SectionPadding = 8.0f;
+	constexpr float ControlPadding = 4.0f;
+}
+
+void SPropertyBreakdownPanel::Construct(const FArguments& InArgs)
+{
+	ObjectPath = InArgs._ObjectPath;
+
+	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
+		+ SHeaderRow::Column(PropertyBreakdownColumns::Property)
+			.DefaultLabel(LOCTEXT("BreakdownPropertyColumn", "Property"))
+			.FillWidth(0.35f)
+		+ SHeaderRow::Column(PropertyBreakdownColumns::Type)
+			.DefaultLabel(LOCTEXT("BreakdownTypeColumn", "Type"))
+			.FillWidth(0.25f)
+		+ SHeaderRow::Column(PropertyBreakdownColumns::Total)
+			.DefaultLabel(LOCTEXT("BreakdownTotalColumn", "Total"))
+			.FillWidth(0.14f)
+		+ SHeaderRow::Column(PropertyBreakdownColumns::Heap)
+			.DefaultLabel(LOCTEXT("BreakdownHeapColumn", "Heap"))
+			.FillWidth(0.14f)
+		+ SHeaderRow::Column(PropertyBreakdownColumns::Share)
+			.DefaultLabel(LOCTEXT("BreakdownShareColumn", "Share"))
+			.FillWidth(0.12f);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		// Toolbar
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(PropertyBreakdownLayoutConstants::SectionPadding)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(PropertyBreakdownLayoutConstants::ControlPadding)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("BreakdownRefresh", "Refresh"))
+				.ToolTipText(LOCTEXT("BreakdownRefreshTooltip", "Measure the object again instead of using the cached breakdown"))
+				.OnClicked(this, &SPropertyBreakdownPanel::OnRefreshClicked)
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			.Padding(PropertyBreakdownLayoutConstants::SectionPadding, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SPropertyBreakdownPanel::GetSummaryText)
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			]
+		]
+
+		// Property tree
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(PropertyBreakdownLayoutConstants::SectionPadding)
+		[
+			SAssignNew(BreakdownTreeView, STreeView<TSharedPtr<FPropertyMemoryNode>>)
+			.TreeItemsSource(&RootItems)
+			.OnGenerateRow(this, &SPropertyBreakdownPanel::OnGenerateRowForTree)
+			.OnGetChildren(this, &SPropertyBreakdownPanel::OnGetChildrenForTree)
+			.SelectionMode(ESelectionMode::Single)
+			.HeaderRow(HeaderRow)
+		]
+	];
+
+	LoadBreakdown(false);
+}
+
+void SPropertyBreakdownPanel::LoadBreakdown(bool bForceRebuild)
+{
+	RootItems.Reset();
+
+	if (TSharedPtr<FPropertyMemoryNode> Root = FObjectProfilerPropertyBreakdown::GetBreakdown(FindObject<UObject>(nullptr, *ObjectPath), bForceRebuild))
+	{
+		RootItems.Add(Root);
+		BreakdownTreeView->SetItemExpansion(Root, true);
+	}
+
+	BreakdownTreeView->RequestTreeRefresh();
+}
+
+TSharedRef<ITableRow> SPropertyBreakdownPanel::OnGenerateRowForTree(TSharedPtr<FPropertyMemoryNode> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SPropertyBreakdownRow, OwnerTable)
+		.Item(Item)
+		.RootBytes(RootItems.Num() > 0 ? RootItems[0]->TotalBytes : 0);
+}
+
+void SPropertyBreakdownPanel::OnGetChildrenForTree(TSharedPtr<FPropertyMemoryNode> Item, TArray<TSharedPtr<FPropertyMemoryNode>>& OutChildren)
+{
+	if (Item.IsValid())
+	{
+		OutChildren = Item->Children;
+	}
+}
+
+FReply SPropertyBreakdownPanel::OnRefreshClicked()
+{
+	LoadBreakdown(true);
+	return FReply::Handled();
+}
+
+FText SPropertyBreakdownPanel::GetSummaryText() const
+{
+	if (RootItems.Num() == 0)
+	{
+		return FText::Format(LOCTEXT("BreakdownObjectGone", "{0} is not loaded."), FText::FromString(ObjectPath));
+	}
+
+	return FText::Format(LOCTEXT("BreakdownSummary", "{0} | {1} total, {2} in containers, strings and owned subobjects"),
+		FText::FromString(ObjectPath),
+		FText::FromString(FObjectProfilerCore::FormatBytes(RootItems[0]->TotalBytes)),
+		FText::FromString(FObjectProfilerCore::FormatBytes(RootItems[0]->GetHeapBytes())));
+}
+
+void SPropertyBreakdownRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Item = InArgs._Item;
+	RootBytes = InArgs._RootBytes;
+	SMultiColumnTableRow<TSharedPtr<FPropertyMemoryNode>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SPropertyBreakdownRow::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (!Item.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	if (ColumnName == PropertyBreakdownColumns::Property)
+	{
+		return SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SExpanderArrow, SharedThis(this))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Item->Name))
+				.ToolTipText(FText::FromString(Item->Name))
+				.Margin(FMargin(4.0f, 2.0f))
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			];
+	}
+
+	FText CellText;
+	if (ColumnName == PropertyBreakdownColumns::Type)
+	{
+		CellText = FText::FromString(Item->TypeName);
+	}
+	else if (ColumnName == PropertyBreakdownColumns::Total)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->TotalBytes));
+	}
+	else if (ColumnName == PropertyBreakdownColumns::Heap)
+	{
+		CellText = FText::FromString(FObjectProfilerCore::FormatBytes(Item->GetHeapBytes()));
+	}
+	else if (ColumnName == PropertyBreakdownColumns::Share)
+	{
+		CellText = RootBytes > 0
+			? FText::Format(LOCTEXT("BreakdownShareValue", "{0}%"), FText::AsNumber(FMath::RoundToInt(100.0 * Item->TotalBytes / RootBytes)))
+			: FText::GetEmpty();
+	}
+
+	return SNew(SBox)
+		.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		[
+			SNew(STextBlock)
+			.Text(CellText)
+			.ToolTipText(CellText)
+			.Margin(FMargin(4.0f, 2.0f))
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "SReferenceGraphWindow.h"
 #include "ObjectProfilerCore.h"
+#include "SPropertyBreakdownPanel.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SComboBox.h"
 #include "Widgets/Input/SSpinBox.h"
@@ -207,6 +208,22 @@ void SReferenceGraphWindow::Construct(const FArguments& InArgs)
 							.OnClicked(this, &SReferenceGraphWindow::OnRefreshClicked)
 						]
 					]
+					
+					// Inspect button
+					+ SHorizontalBox::Slot()
+					.AutoWidth()
+					.Padding(ReferenceLayoutConstants::ControlPadding, 0, 0, 0)
+					[
+						SNew(SBox)
+						.MinDesiredWidth(ReferenceLayoutConstants::ButtonMinWidth)
+						[
+							SNew(SButton)
+							.Text(LOCTEXT("InspectReferenced", "Inspect"))
+							.ToolTipText(LOCTEXT("InspectReferencedTooltip", "Break the selected instance's memory down by reflected property"))
+							.OnClicked(this, &SReferenceGraphWindow::OnInspectClicked)
+							.IsEnabled_Lambda([this]() { return SelectedInstance.IsValid() && !SelectedInstance->IsEmpty(); })
+						]
+					]
 				]
 			]
 			
@@ -365,6 +382,28 @@ FReply SReferenceGraphWindow::OnRefreshClicked()
 	return FReply::Handled();
 }
 
+FReply SReferenceGraphWindow::OnInspectClicked()
+{
+	if (!SelectedInstance.IsValid())
+	{
+		return FReply::Handled();
+	}
+	
+	TSharedRef<SWindow> BreakdownWindow = SNew(SWindow)
+		.Title(FText::Format(LOCTEXT("ReferenceBreakdownWindowTitle", "Property Memory: {0}"), FText::FromString(*SelectedInstance)))
+		.ClientSize(FVector2D(1000, 650))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SPropertyBreakdownPanel)
+			.ObjectPath(*SelectedInstance)
+		];
+
+	FSlateApplication::Get().AddWindow(BreakdownWindow);
+	
+	return FReply::Handled();
+}
+
 void SReferenceGraphWindow::OnInstanceSelected(TSharedPtr<FString> Item, ESelectInfo::Type SelectInfo)
 {
 	SelectedInstance = Item;
@@ -2,6 +2,7 @@
 
 #include "SSnapshotManager.h"
 #include "ObjectProfilerCore.h"
+#include "ObjectProfilerEventLog.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Layout/SScrollBox.h"
@@ -27,12 +28,15 @@ namespace SnapshotLayoutConstants
 	constexpr float NameInputMinWidth = 100.0f;
 	constexpr float ControlPadding = 2.0f;
 	constexpr float SectionPadding = 4.0f;
+	constexpr int32 ReplaySnapshotCount = 10;
 }
 
 void SSnapshotManager::Construct(const FArguments& InArgs)
 {
 	OnCompareSnapshotsDelegate = InArgs._OnCompareSnapshots;
 	OnViewDeltaDelegate = InArgs._OnViewDelta;
+	OnReplayLoadedDelegate = InArgs._OnReplayLoaded;
+	Scope = InArgs._Scope;
 
 	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
 		+ SHeaderRow::Column(SnapshotColumns::Name)
@@ -244,6 +248,53 @@ void SSnapshotManager::Construct(const FArguments& InArgs)
 					]
 				]
 			]
+			
+			// Event recording row
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(SnapshotLayoutConstants::SectionPadding, 0.0f, SnapshotLayoutConstants::SectionPadding, SnapshotLayoutConstants::SectionPadding)
+			[
+				SNew(SBox)
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+				[
+					SNew(SHorizontalBox)
+					
+					+ SHorizontalBox::Slot()
+					.AutoWidth()
+					.Padding(SnapshotLayoutConstants::ControlPadding)
+					[
+						SNew(SBox)
+						.MinDesiredWidth(SnapshotLayoutConstants::ButtonMinWidth)
+						[
+							SNew(SButton)
+							.Text(this, &SSnapshotManager::GetRecordButtonText)
+							.ToolTipText(LOCTEXT("RecordTooltip", "Record every object create/delete to an event log for offline replay"))
+							.OnClicked(this, &SSnapshotManager::OnRecordClicked)
+						]
+					]
+					
+					+ SHorizontalBox::Slot()
+					.AutoWidth()
+					.Padding(SnapshotLayoutConstants::ControlPadding)
+					[
+						SNew(SBox)
+						.MinDesiredWidth(SnapshotLayoutConstants::ButtonMinWidth)
+						[
+							SNew(SButton)
+							.Text(LOCTEXT("Replay", "Replay"))
+							.ToolTipText(LOCTEXT("ReplayTooltip", "Load an event log and import it as a series of snapshots"))
+							.OnClicked(this, &SSnapshotManager::OnReplayClicked)
+							.IsEnabled_Lambda([]() { return !FObjectEventRecorder::IsRecording(); })
+						]
+					]
+					
+					+ SHorizontalBox::Slot()
+					.FillWidth(1.0f)
+					[
+						SNullWidget::NullWidget
+					]
+				]
+			]
 		]
 	];
 	
@@ -294,7 +345,7 @@ void SSnapshotManager::OnSelectionChanged(TSharedPtr<FObjectSnapshot> Item, ESel
 
 FReply SSnapshotManager::OnTakeSnapshotClicked()
 {
-	FObjectProfilerCore::TakeSnapshot(NewSnapshotName);
+	FObjectProfilerCore::RequestSnapshot(NewSnapshotName, Scope.Get(FProfilerCollectionScope()));
 	NewSnapshotName.Empty();
 	if (SnapshotNameBox.IsValid())
 	{
@@ -445,6 +496,77 @@ FReply SSnapshotManager::OnViewDeltaClicked()
 	return FReply::Handled();
 }
 
+FReply SSnapshotManager::OnRecordClicked()
+{
+	if (FObjectEventRecorder::IsRecording())
+	{
+		FObjectEventRecorder::StopRecording();
+	}
+	else
+	{
+		FObjectEventRecorder::StartRecording();
+	}
+	return FReply::Handled();
+}
+
+FText SSnapshotManager::GetRecordButtonText() const
+{
+	if (FObjectEventRecorder::IsRecording())
+	{
+		return FText::Format(LOCTEXT("StopRecording", "Stop ({0})"), FText::AsNumber(FObjectEventRecorder::GetRecordedEventCount()));
+	}
+	return LOCTEXT("Record", "Record");
+}
+
+FReply SSnapshotManager::OnReplayClicked()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!DesktopPlatform)
+	{
+		return FReply::Handled();
+	}
+	
+	TArray<FString> OutFiles;
+	const bool bOpened = DesktopPlatform->OpenFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr),
+		TEXT("Load Event Log"),
+		FObjectEventRecorder::GetDefaultRecordingDirectory(),
+		TEXT(""),
+		TEXT("Object Event Logs (*.uoplog)|*.uoplog"),
+		EFileDialogFlags::None,
+		OutFiles
+	);
+	
+	if (!bOpened || OutFiles.Num() == 0)
+	{
+		return FReply::Handled();
+	}
+	
+	TSharedRef<FObjectEventReplay> Replay = MakeShared<FObjectEventReplay>();
+	if (!Replay->LoadFromFile(OutFiles[0]))
+	{
+		return FReply::Handled();
+	}
+	
+	const double Duration = Replay->GetDuration();
+	const FString BaseName = FPaths::GetBaseFilename(OutFiles[0]);
+	
+	for (int32 i = 0; i < SnapshotLayoutConstants::ReplaySnapshotCount; ++i)
+	{
+		const double Seconds = Duration * i / (SnapshotLayoutConstants::ReplaySnapshotCount - 1);
+		FObjectProfilerCore::AddSnapshot(Replay->BuildSnapshotAt(Seconds, FString::Printf(TEXT("%s @%.1fs"), *BaseName, Seconds)));
+	}
+	
+	RefreshList();
+	
+	if (OnReplayLoadedDelegate.IsBound())
+	{
+		OnReplayLoadedDelegate.Execute(Replay);
+	}
+	
+	return FReply::Handled();
+}
+
 void SSnapshotManager::OnSnapshotNameCommitted(const FText& NewText, ETextCommit::Type CommitType)
 {
 	NewSnapshotName = NewText.ToString();
@@ -0,0 +1,270 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "SStartupTimelineWindow.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Notifications/SProgressBar.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "ObjectProfiler"
+
+namespace StartupColumns
+{
+	static const FName Phase("Phase");
+	static const FName Start("Start");
+	static const FName Duration("Duration");
+	static const FName Objects("Objects");
+	static const FName Share("Share");
+}
+
+namespace StartupLayoutConstants
+{
+	constexpr float SectionPadding = 8.0f;
+	constexpr int32 TopEntryCount = 25;
+}
+
+void SStartupTimelineWindow::Construct(const FArguments& InArgs)
+{
+	for (const FStartupPhaseStats& Phase : FObjectProfilerStartupCapture::GetPhases())
+	{
+		PhaseItems.Add(MakeShared<FStartupPhaseStats>(Phase));
+		MaxPhaseCount = FMath::Max(MaxPhaseCount, Phase.TotalCreated);
+	}
+
+	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
+		+ SHeaderRow::Column(StartupColumns::Phase)
+			.DefaultLabel(LOCTEXT("StartupPhaseColumn", "Phase"))
+			.FillWidth(0.3f)
+		+ SHeaderRow::Column(StartupColumns::Start)
+			.DefaultLabel(LOCTEXT("StartupStartColumn", "Start"))
+			.FillWidth(0.12f)
+		+ SHeaderRow::Column(StartupColumns::Duration)
+			.DefaultLabel(LOCTEXT("StartupDurationColumn", "Duration"))
+			.FillWidth(0.12f)
+		+ SHeaderRow::Column(StartupColumns::Objects)
+			.DefaultLabel(LOCTEXT("StartupObjectsColumn", "Objects"))
+			.FillWidth(0.16f)
+		+ SHeaderRow::Column(StartupColumns::Share)
+			.DefaultLabel(LOCTEXT("StartupShareColumn", "Created"))
+			.FillWidth(0.3f);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(StartupLayoutConstants::SectionPadding)
+		[
+			SNew(STextBlock)
+			.Text(this, &SStartupTimelineWindow::GetSummaryText)
+			.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(StartupLayoutConstants::SectionPadding)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+
+			// Phase list
+			+ SSplitter::Slot()
+			.Value(0.4f)
+			[
+				SAssignNew(PhaseListView, SListView<TSharedPtr<FStartupPhaseStats>>)
+				.ListItemsSource(&PhaseItems)
+				.OnGenerateRow(this, &SStartupTimelineWindow::OnGenerateRowForList)
+				.OnSelectionChanged(this, &SStartupTimelineWindow::OnPhaseSelected)
+				.SelectionMode(ESelectionMode::Single)
+				.HeaderRow(HeaderRow)
+			]
+
+			// Top classes and modules for the selected phase
+			+ SSplitter::Slot()
+			.Value(0.6f)
+			[
+				SNew(SSplitter)
+				.Orientation(Orient_Horizontal)
+
+				+ SSplitter::Slot()
+				.Value(0.6f)
+				[
+					SNew(SVerticalBox)
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(4.0f)
+					[
+						SNew(STextBlock)
+						.Text(LOCTEXT("StartupTopClasses", "Top Classes"))
+						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 10))
+					]
+					+ SVerticalBox::Slot()
+					.FillHeight(1.0f)
+					[
+						SNew(SScrollBox)
+						+ SScrollBox::Slot()
+						[
+							SAssignNew(TopClassesBox, SVerticalBox)
+						]
+					]
+				]
+
+				+ SSplitter::Slot()
+				.Value(0.4f)
+				[
+					SNew(SVerticalBox)
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(4.0f)
+					[
+						SNew(STextBlock)
+						.Text(LOCTEXT("StartupTopModules", "Top Modules"))
+						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 10))
+					]
+					+ SVerticalBox::Slot()
+					.FillHeight(1.0f)
+					[
+						SNew(SScrollBox)
+						+ SScrollBox::Slot()
+						[
+							SAssignNew(TopModulesBox, SVerticalBox)
+						]
+					]
+				]
+			]
+		]
+	];
+
+	if (PhaseItems.Num() > 0)
+	{
+		PhaseListView->SetSelection(PhaseItems[0]);
+	}
+}
+
+TSharedRef<ITableRow> SStartupTimelineWindow::OnGenerateRowForList(TSharedPtr<FStartupPhaseStats> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SStartupPhaseRow, OwnerTable)
+		.Item(Item)
+		.MaxPhaseCount(MaxPhaseCount);
+}
+
+void SStartupTimelineWindow::OnPhaseSelected(TSharedPtr<FStartupPhaseStats> Item, ESelectInfo::Type SelectInfo)
+{
+	TopClassesBox->ClearChildren();
+	TopModulesBox->ClearChildren();
+
+	if (!Item.IsValid())
+	{
+		return;
+	}
+
+	FillTopEntries(TopClassesBox, Item->ClassCounts);
+	FillTopEntries(TopModulesBox, Item->ModuleCounts);
+}
+
+void SStartupTimelineWindow::FillTopEntries(TSharedPtr<SVerticalBox> Box, const TMap<FString, int32>& Counts)
+{
+	int32 Added = 0;
+	for (const TPair<FString, int32>& Pair : Counts)
+	{
+		if (Added++ >= StartupLayoutConstants::TopEntryCount)
+		{
+			break;
+		}
+
+		Box->AddSlot()
+		.AutoHeight()
+		.Padding(2.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Pair.Key))
+				.Clipping(EWidgetClipping::ClipToBoundsAlways)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(8.0f, 0.0f, 4.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(FText::AsNumber(Pair.Value))
+			]
+		];
+	}
+}
+
+FText SStartupTimelineWindow::GetSummaryText() const
+{
+	if (FObjectProfilerStartupCapture::IsCapturing())
+	{
+		return LOCTEXT("StartupCapturing", "Startup capture is still running");
+	}
+
+	if (PhaseItems.Num() == 0)
+	{
+		return LOCTEXT("StartupNoData", "No startup capture. Launch with -ObjectProfilerStartup or set [ObjectProfiler] bCaptureStartup=True in DefaultEngine.ini");
+	}
+
+	return FText::Format(LOCTEXT("StartupSummary", "{0} objects created across {1} loading phases in {2}s"),
+		FText::AsNumber(FObjectProfilerStartupCapture::GetTotalCreated()),
+		FText::AsNumber(PhaseItems.Num()),
+		FText::AsNumber(PhaseItems.Last()->EndSeconds));
+}
+
+void SStartupPhaseRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
+{
+	Item = InArgs._Item;
+	MaxPhaseCount = FMath::Max(1, InArgs._MaxPhaseCount);
+	SMultiColumnTableRow<TSharedPtr<FStartupPhaseStats>>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+}
+
+TSharedRef<SWidget> SStartupPhaseRow::GenerateWidgetForColumn(const FName& ColumnName)
+{
+	if (!Item.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	FText CellText;
+	if (ColumnName == StartupColumns::Phase)
+	{
+		CellText = FText::FromString(Item->PhaseName);
+	}
+	else if (ColumnName == StartupColumns::Start)
+	{
+		CellText = FText::FromString(FString::Printf(TEXT("%.2fs"), Item->StartSeconds));
+	}
+	else if (ColumnName == StartupColumns::Duration)
+	{
+		CellText = FText::FromString(FString::Printf(TEXT("%.2fs"), Item->GetDuration()));
+	}
+	else if (ColumnName == StartupColumns::Objects)
+	{
+		CellText = FText::AsNumber(Item->TotalCreated);
+	}
+	else if (ColumnName == StartupColumns::Share)
+	{
+		return SNew(SBox)
+			.Padding(FMargin(4.0f, 4.0f))
+			[
+				SNew(SProgressBar)
+				.Percent(static_cast<float>(Item->TotalCreated) / MaxPhaseCount)
+			];
+	}
+
+	return SNew(SBox)
+		.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		[
+			SNew(STextBlock)
+			.Text(CellText)
+			.Margin(FMargin(4.0f, 2.0f))
+			.Clipping(EWidgetClipping::ClipToBoundsAlways)
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,62 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "ObjectProfilerTypes.h"
+
+struct FArchiveSizeEntry
+{
+	FString ClassName;
+	int32 InstanceCount = 0;
+	int32 MeasuredCount = 0;
+	int64 MeasuredResourceBytes = 0;
+	int64 MeasuredBytes = 0;
+
+	int64 GetEstimatedArchiveBytes() const
+	{
+		return MeasuredCount > 0 ? MeasuredBytes * InstanceCount / MeasuredCount : 0;
+	}
+
+	int64 GetEstimatedResourceBytes() const
+	{
+		return MeasuredCount > 0 ? MeasuredResourceBytes * InstanceCount / MeasuredCount : 0;
+	}
+
+	int64 GetUnderReportedBytes() const
+	{
+		return GetEstimatedArchiveBytes() - GetEstimatedResourceBytes();
+	}
+};
+
+DECLARE_DELEGATE_OneParam(FOnArchiveSizeComplete, const TArray<FArchiveSizeEntry>&);
+
+class OBJECTPROFILEREDITOR_API FObjectProfilerArchiveSizer
+{
+public:
+	static bool Start(const TArray<TSharedPtr<FObjectClassStats>>& Stats, int32 MaxSamplesPerClass, FOnArchiveSizeComplete OnComplete);
+	static void Cancel();
+	static bool IsRunning();
+	static float GetProgress();
+
+	static constexpr int32 DefaultSamplesPerClass = 64;
+
+private:
+	struct FPendingMeasure
+	{
+		TWeakObjectPtr<UObject> Object;
+		int32 EntryIndex = INDEX_NONE;
+	};
+
+	static bool OnTick(float DeltaTime);
+	static void Finish();
+
+	static TArray<FPendingMeasure> PendingObjects;
+	static int32 NextObjectIndex;
+	static TArray<FArchiveSizeEntry> Entries;
+	static FOnArchiveSizeComplete CompletionDelegate;
+	static FTSTicker::FDelegateHandle TickerHandle;
+
+	static constexpr double TickBudgetSeconds = 0.004;
+};
\ No newline at end of file
@@ -0,0 +1,69 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class FProperty;
+
+struct FContainerSlackEntry
+{
+	FString ClassName;
+	FString PropertyName;
+	FString ContainerType;
+	int32 InstanceCount = 0;
+	int64 UsedBytes = 0;
+	int64 AllocatedBytes = 0;
+	TArray<TPair<FString, int64>> Examples;
+
+	static constexpr int32 MaxExamples = 5;
+
+	int64 GetWastedBytes() const
+	{
+		return AllocatedBytes - UsedBytes;
+	}
+
+	void OfferExample(const UObject* Object, int64 WastedBytes);
+};
+
+DECLARE_DELEGATE_OneParam(FOnContainerSlackComplete, const TArray<FContainerSlackEntry>&);
+
+class OBJECTPROFILEREDITOR_API FObjectProfilerContainerSlack
+{
+public:
+	static bool Start(const TArray<UClass*>& Classes, FOnContainerSlackComplete OnComplete);
+	static void Cancel();
+	static bool IsRunning();
+	static float GetProgress();
+
+private:
+	struct FContainerSlot
+	{
+		const FProperty* Property = nullptr;
+		int32 Offset = 0;
+		FString Name;
+	};
+
+	struct FClassScan
+	{
+		TArray<FContainerSlot> Slots;
+		TArray<FContainerSlackEntry> Entries;
+	};
+
+	static bool OnTick(float DeltaTime);
+	static void ScanObject(UObject* Object);
+	static FClassScan& FindOrAddClassScan(const UClass* Class);
+	static void GatherContainerSlots(const UStruct* Struct, int32 BaseOffset, const FString& Prefix, int32 Depth, TArray<FContainerSlot>& OutSlots);
+	static void MeasureContainer(const FProperty* Property, const void* ValuePtr, int64& OutUsedBytes, int64& OutAllocatedBytes);
+	static void Finish();
+
+	static TArray<TWeakObjectPtr<UObject>> PendingObjects;
+	static int32 NextObjectIndex;
+	static TMap<const UClass*, FClassScan> ClassScans;
+	static FOnContainerSlackComplete CompletionDelegate;
+	static FTSTicker::FDelegateHandle TickerHandle;
+
+	static constexpr double TickBudgetSeconds = 0.004;
+	static constexpr int32 MaxStructDepth = 4;
+};
\ No newline at end of file
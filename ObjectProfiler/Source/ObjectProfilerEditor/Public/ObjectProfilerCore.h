@@ -5,12 +5,18 @@
 #include "CoreMinimal.h"
 #include "Containers/Ticker.h"
 #include "UObject/UObjectArray.h"
+#include "UObject/ObjectKey.h"
 #include "ObjectProfilerTypes.h"
 
 DECLARE_DELEGATE_OneParam(FOnObjectStatsCollected, TArray<TSharedPtr<FObjectClassStats>>);
 DECLARE_DELEGATE_OneParam(FOnCollectionProgress, float);
+DECLARE_DELEGATE_TwoParams(FOnPartialResults, const TArray<TSharedPtr<FObjectClassStats>>&, float);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnRealTimeUpdate, const TArray<TSharedPtr<FObjectClassStats>>&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnSnapshotTaken, const FObjectSnapshot&);
+DECLARE_DELEGATE_OneParam(FOnHeapWalkComplete, const FHeapWalkResult&);
+
+class FObjectProfilerSession;
+class AActor;
 
 class OBJECTPROFILEREDITOR_API FObjectProfilerCore
 {
@@ -20,32 +26,67 @@ public:
 	static void CollectObjectStatsAsync(
 		int32 MaxSamplesPerClass,
 		FOnObjectStatsCollected OnComplete,
-		FOnCollectionProgress OnProgress = FOnCollectionProgress());
+		FOnCollectionProgress OnProgress = FOnCollectionProgress(),
+		const FProfilerCollectionScope& Scope = FProfilerCollectionScope(),
+		FOnPartialResults OnPartialResults = FOnPartialResults());
+	
+	static void CollectObjectStatsAsync(
+		const TSharedRef<FObjectProfilerSession>& Session,
+		const FProfilerCollectionScope& Scope,
+		int32 MaxSamplesPerClass,
+		FOnObjectStatsCollected OnComplete,
+		FOnCollectionProgress OnProgress = FOnCollectionProgress(),
+		FOnPartialResults OnPartialResults = FOnPartialResults());
 	
 	static void CancelAsyncCollection();
 	static bool IsAsyncCollectionInProgress();
+	static void SetCollectionConsistency(ECollectionConsistency Consistency);
+	static ECollectionConsistency GetCollectionConsistency();
+	static void SetCollectionSizing(ECollectionSizing Sizing);
+	static ECollectionSizing GetCollectionSizing();
+	static void SetResourceSizeMode(EResourceSizeMode::Type Mode);
+	static EResourceSizeMode::Type GetResourceSizeMode();
 	
 	static TArray<FString> GetInstancesOfClass(const UClass* InClass);
 	static TArray<FString> GetInstancesOfClass(const FString& ClassName);
 	
-	static void TakeSnapshot(const FString& SnapshotName = TEXT(""));
+	static void TakeSnapshot(const FString& SnapshotName = TEXT(""), const FProfilerCollectionScope& Scope = FProfilerCollectionScope());
+	static void RequestSnapshot(const FString& SnapshotName = TEXT(""), const FProfilerCollectionScope& Scope = FProfilerCollectionScope());
 	static TArray<TSharedPtr<FObjectClassStats>> GetDeltaSinceSnapshot(int32 SnapshotIndex = -1);
 	static TArray<TSharedPtr<FObjectClassStats>> CompareTwoSnapshots(int32 IndexA, int32 IndexB);
+	static TArray<TSharedPtr<FObjectClassStats>> DiffSnapshots(const FObjectSnapshot& SnapshotA, const FObjectSnapshot& SnapshotB, bool bIncludeSizes = true);
 	
 	static const TArray<FObjectSnapshot>& GetSnapshotHistory();
+	static void AddSnapshot(const FObjectSnapshot& Snapshot);
 	static void ClearSnapshotHistory();
 	static void DeleteSnapshot(int32 Index);
 	static bool SaveSnapshotsToFile(const FString& FilePath);
 	static bool LoadSnapshotsFromFile(const FString& FilePath);
 	
+	static TSharedRef<FObjectProfilerSession> GetDefaultSession();
+	static void ResetDefaultSession();
+	
+	static FHeapWalkResult WalkHeap(const FHeapWalkRequest& Request);
+	static void RequestHeapWalk(const FHeapWalkRequest& Request, FOnHeapWalkComplete OnComplete);
+	static bool HasPendingHeapWalks();
+	
 	static void ForceGarbageCollection();
 	static int32 GetTotalObjectCount();
 	
 	static FString FormatBytes(int64 Bytes);
+	static int64 GetObjectSize(UObject* Obj);
+	static int32 GetSparseCapacity(const void* SetPtr);
+	static int64 GetHashBytes(int32 NumElements);
 	static EObjectCategory CategorizeClass(const UClass* InClass);
 	static EObjectSource GetObjectSource(const UClass* InClass);
 	static FString GetModuleName(const UClass* InClass);
 	static FString GetSourceDisplayName(EObjectSource Source);
+	static FString GetCategoryDisplayName(EObjectCategory Category);
+	static UWorld* GetOwningWorld(const UObject* Object);
+	static FName GetWorldLabel(const UWorld* World);
+	static FString DescribeScope(const FProfilerCollectionScope& Scope);
+	static FString GetOwnerLabel(FName OwnerLabel);
+	static FString GetOwnerLabel(const FObjectKey& OuterKey);
 	
 	static void StartRealTimeMonitoring(float IntervalSeconds);
 	static void StopRealTimeMonitoring();
@@ -62,6 +103,8 @@ public:
 	
 	static TMap<EObjectCategory, int64> GetMemoryBreakdownByCategory();
 	static TMap<FString, int64> GetMemoryBreakdownByModule();
+	static const TArray<FLargestObjectEntry>& GetLargestObjects();
+	static bool FocusObjectInEditor(const FString& ObjectPath);
 	
 	static void SetLeakDetectionThreshold(int32 ConsecutiveTicks);
 	static int32 GetLeakDetectionThreshold();
@@ -74,15 +117,75 @@ public:
 	static TArray<TSharedPtr<FProfilerTreeItem>> BuildTreeView(
 		const TArray<TSharedPtr<FObjectClassStats>>& Stats,
 		EProfilerGroupMode GroupMode);
+	
+	static TArray<TSharedPtr<FProfilerTreeItem>> BuildTreeView(
+		const TArray<TSharedPtr<FObjectClassStats>>& Stats,
+		const TArray<EProfilerGroupMode>& GroupLevels);
+	
+	static void ComputeHierarchyRollups(TArray<TSharedPtr<FObjectClassStats>>& Stats);
 
 private:
+	friend class FObjectProfilerSession;
+	
+	struct FPendingHeapWalk
+	{
+		FHeapWalkRequest Request;
+		FOnHeapWalkComplete OnComplete;
+	};
+	
+	struct FQueuedCollection
+	{
+		TWeakPtr<FObjectProfilerSession> Session;
+		FProfilerCollectionScope Scope;
+		int32 MaxSamplesPerClass = 5;
+		TArray<FOnObjectStatsCollected> Consumers;
+		FOnCollectionProgress OnProgress;
+		FOnPartialResults OnPartialResults;
+	};
+	
+	struct FIncrementalClassInfo
+	{
+		TWeakObjectPtr<UClass> ClassPtr;
+		FString ClassName;
+		FName ClassFName;
+		EObjectCategory Category = EObjectCategory::Unknown;
+		EObjectSource Source = EObjectSource::Unknown;
+		FString ModuleName;
+		TSharedPtr<const FIncrementalClassInfo, ESPMode::ThreadSafe> SuperInfo;
+	};
+	
 	struct FIncrementalClassData
 	{
 		int32 Count = 0;
-		EObjectCategory CachedCategory = EObjectCategory::Unknown;
-		EObjectSource CachedSource = EObjectSource::Unknown;
-		FString CachedModuleName;
-		bool bDirty = true;
+		TSharedPtr<const FIncrementalClassInfo, ESPMode::ThreadSafe> Info;
+		TMap<uint16, int32> WorldCounts;
+	};
+	
+	struct FIncrementalCountsSnapshot
+	{
+		struct FEntry
+		{
+			TSharedPtr<const FIncrementalClassInfo, ESPMode::ThreadSafe> Info;
+			int32 Count = 0;
+			int32 FirstWorldCount = 0;
+			int32 NumWorldCounts = 0;
+		};
+		
+		TArray<FEntry> Entries;
+		TArray<TPair<uint16, int32>> WorldCounts;
+		TArray<FName> WorldSlotLabels;
+	};
+	
+	struct FWorldResolveCache
+	{
+		TMap<FObjectKey, UWorld*> OuterToWorld;
+		TMap<const UWorld*, FName> WorldLabels;
+		
+		void Reset()
+		{
+			OuterToWorld.Reset();
+			WorldLabels.Reset();
+		}
 	};
 	
 	class FProfilerCreateListener : public FUObjectArray::FUObjectCreateListener
@@ -99,13 +202,43 @@ private:
 		virtual void OnUObjectArrayShutdown() override;
 	};
 
+	struct FJournalEntry
+	{
+		TWeakObjectPtr<UClass> Class;
+		int32 ObjectIndex = INDEX_NONE;
+		bool bExistedAtStart = false;
+		bool bDeleted = false;
+		bool bCounted = false;
+	};
+	
+	class FJournalCreateListener : public FUObjectArray::FUObjectCreateListener
+	{
+	public:
+		virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+		virtual void OnUObjectArrayShutdown() override;
+	};
+	
+	class FJournalDeleteListener : public FUObjectArray::FUObjectDeleteListener
+	{
+	public:
+		virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+		virtual void OnUObjectArrayShutdown() override;
+	};
+
 	enum class EAsyncPhase : uint8
 	{
 		Idle,
 		Enumerating,
 		Processing,
+		Sizing,
 		Complete
 	};
+	
+	struct FSizingTally
+	{
+		int32 Sized = 0;
+		int32 Missing = 0;
+	};
 
 	struct FAsyncCollectionState
 	{
@@ -113,14 +246,32 @@ private:
 		
 		TArray<TWeakObjectPtr<UObject>> ObjectsToProcess;
 		TMap<UClass*, TSharedPtr<FObjectClassStats>> StatsMap;
+		FWorldResolveCache WorldCache;
+		FLargestObjectsList LargestObjects;
+		
+		FProfilerCollectionScope Scope;
+		TArray<TWeakObjectPtr<UClass>> ScopedObjectClasses;
+		bool bScoped = false;
+		
+		bool bDeferredSizing = false;
+		TMap<UClass*, TArray<int32>> SizingBuckets;
+		TArray<int32> SizingOrder;
+		TArray<UClass*> SizingClassOrder;
+		TArray<int32> SizingClassEnds;
+		TMap<UClass*, FSizingTally> SizingTallies;
+		int32 SizingIndex = 0;
+		int32 SizingClassCursor = 0;
 		
 		int32 EnumerationIndex = 0;
 		int32 ProcessingIndex = 0;
 		int32 TotalObjectsEstimate = 0;
 		int32 MaxSamplesPerClass = 5;
 		
-		FOnObjectStatsCollected OnComplete;
+		TWeakPtr<FObjectProfilerSession> Session;
+		TArray<FOnObjectStatsCollected> Consumers;
 		FOnCollectionProgress OnProgress;
+		FOnPartialResults OnPartialResults;
+		double LastPartialPublishTime = 0.0;
 		
 		FTSTicker::FDelegateHandle TickerHandle;
 		
@@ -129,47 +280,139 @@ private:
 			Phase = EAsyncPhase::Idle;
 			ObjectsToProcess.Empty();
 			StatsMap.Empty();
+			WorldCache.Reset();
+			LargestObjects = FLargestObjectsList();
+			Scope = FProfilerCollectionScope();
+			ScopedObjectClasses.Empty();
+			bScoped = false;
+			bDeferredSizing = false;
+			SizingBuckets.Empty();
+			SizingOrder.Empty();
+			SizingClassOrder.Empty();
+			SizingClassEnds.Empty();
+			SizingTallies.Empty();
+			SizingIndex = 0;
+			SizingClassCursor = 0;
 			EnumerationIndex = 0;
 			ProcessingIndex = 0;
 			TotalObjectsEstimate = 0;
-			OnComplete.Unbind();
+			Session.Reset();
+			Consumers.Empty();
 			OnProgress.Unbind();
+			OnPartialResults.Unbind();
+			LastPartialPublishTime = 0.0;
 		}
 	};
 
 	static bool OnAsyncTick(float DeltaTime);
 	static void TickEnumeration();
 	static void TickProcessing();
+	static void TickSizing();
 	static void FinalizeCollection();
+	static void BeginCollection(FQueuedCollection& Request);
+	static void StartNextQueuedCollection();
+	static bool IsSameCollection(const TWeakPtr<FObjectProfilerSession>& Session, const FProfilerCollectionScope& Scope, const TSharedRef<FObjectProfilerSession>& OtherSession, const FProfilerCollectionScope& OtherScope);
+	static void PublishPartialResults(float Progress, int32 MaxClasses);
+	static void BeginSizingPhase();
+	static void FinishSizedClass(UClass* SizedClass);
+	
+	static FObjectClassStats& FindOrAddClassStats(TMap<UClass*, TSharedPtr<FObjectClassStats>>& StatsMap, UClass* ObjClass);
+	static void AccumulateObject(FObjectClassStats& Stats, UObject* Obj, FWorldResolveCache& WorldCache, int32 Sign, int32 MaxSamples, bool bMeasureSize = true, FLargestObjectsList* LargestObjects = nullptr);
+	static void RecordObjectSize(FObjectClassStats& Stats, const UObject* Obj, const FObjectSizeBreakdown& Breakdown, int32 Sign, FWorldResolveCache& WorldCache, FLargestObjectsList* LargestObjects = nullptr);
+	static FObjectSizeBreakdown MeasureObjectSize(UObject* Obj);
+	static void RecordObjectFlags(FObjectFlagCensus& Census, const UObject* Obj, int32 Sign);
+	static void RecordGarbageObject(TMap<UClass*, TSharedPtr<FObjectClassStats>>& StatsMap, const UObject* Obj);
+	static void TrackLargestObject(FLargestObjectsList& LargestObjects, const UObject* Obj, int64 Size, int32 Sign, FWorldResolveCache& WorldCache);
+	
+	struct FActorFootprintTally
+	{
+		int32 ChargedObjectCount = 0;
+		int64 OwnSizeBytes = 0;
+		int64 TotalSizeBytes = 0;
+	};
+	
+	static AActor* ResolveOwningActor(UObject* Object, TMap<const UObject*, AActor*>& OuterToActor);
+	static void RollupActorFootprints(const TMap<AActor*, FActorFootprintTally>& Tallies, TArray<FActorFootprintEntry>& OutFootprints);
 	
-	static bool OnRealTimeTick(float DeltaTime);
-	static void UpdateRealTimeStats();
-	static void OnRealTimeCollectionComplete(TArray<TSharedPtr<FObjectClassStats>> Results);
+	static void StartCollectionJournal();
+	static void StopCollectionJournal();
+	static void ReconcileCollectionJournal();
 	
 	static bool IsSafeForResourceSizeQuery(const UObject* Obj);
 	
-	static TArray<FObjectSnapshot> SnapshotHistory;
-	static TMap<FString, TSharedPtr<FObjectClassStats>> PreviousStats;
+	static UWorld* ResolveOwningWorld(const UObject* Object, TMap<FObjectKey, UWorld*>& OuterToWorld);
+	static FName ResolveWorldLabel(const UObject* Object, FWorldResolveCache& Cache);
+	static FName ResolvePackageLabel(const UObject* Object);
+	static uint16 GetIncrementalWorldSlot(const UObject* Object);
+	
+	static bool MatchesPackagePrefixes(const UPackage* Package, const FProfilerCollectionScope& Scope);
+	static bool MatchesScope(const UObject* Object, const FProfilerCollectionScope& Scope, TMap<const UPackage*, bool>& PackageMatches, TMap<FObjectKey, UWorld*>& OuterToWorld);
+	static void GatherScopedObjects(const FProfilerCollectionScope& Scope, TArray<UObject*>& OutObjects);
+	static TSharedPtr<FObjectClassStats> MakeOwnerRowStats(const FObjectClassStats& ClassStats, const FObjectWorldStats& OwnerValue);
+	template <typename KeyType>
+	static TArray<TSharedPtr<FProfilerTreeItem>> BuildOwnerTreeView(const TArray<TSharedPtr<FObjectClassStats>>& Stats, TMap<KeyType, FObjectWorldStats> FObjectClassStats::* OwnerStats, FProfilerTreeItem::EItemType GroupType);
+	static TArray<TSharedPtr<FProfilerTreeItem>> BuildHierarchyTreeView(const TArray<TSharedPtr<FObjectClassStats>>& Stats);
+	static TArray<TSharedPtr<FProfilerTreeItem>> BuildNestedTreeView(const TArray<TSharedPtr<FObjectClassStats>>& Stats, const TArray<EProfilerGroupMode>& GroupLevels);
+	static bool GetGroupKey(const FObjectClassStats& Stats, EProfilerGroupMode GroupLevel, FString& OutGroupName, FProfilerTreeItem::EItemType& OutGroupType);
+	static void SortGroupsByCount(TArray<TSharedPtr<FProfilerTreeItem>>& Items);
+	static void RollupClassHierarchy(TArray<TSharedPtr<FObjectClassStats>>& Stats, TFunctionRef<TSharedPtr<FObjectClassStats>(const FObjectClassStats&)> ResolveSuperStats);
+	static void RollupIncrementalHierarchy(TArray<TSharedPtr<FObjectClassStats>>& Stats, const FIncrementalCountsSnapshot& Counts);
+	static TSharedPtr<const FIncrementalClassInfo, ESPMode::ThreadSafe> GetIncrementalClassInfo(UClass* InClass);
+	static void RefreshGarbageCollectBinding();
+	static void OnPostGarbageCollect();
+	
+	static void ExecuteHeapWalk(const FHeapWalkRequest& Request, FHeapWalkResult& Result);
+	static bool OnHeapWalkTick(float DeltaTime);
+	static FString FormatInstanceEntry(const UObject* Obj);
+	static void FillSnapshotFromWalk(FObjectSnapshot& Snapshot, const FHeapWalkResult& WalkResult, FName WorldLabel);
+	static void FillSnapshotFromScope(FObjectSnapshot& Snapshot, const FProfilerCollectionScope& Scope, bool bMeasureSizes);
+	
+	static bool GetScopeWorldLabel(const FProfilerCollectionScope& Scope, FName& OutWorldLabel);
+	static void ProjectStatsToWorld(TArray<TSharedPtr<FObjectClassStats>>& Stats, FName WorldLabel);
+	static TArray<TSharedPtr<FObjectClassStats>> CollectScopedStats(const FProfilerCollectionScope& Scope, int32 MaxSamplesPerClass);
+	static TArray<TSharedPtr<FObjectClassStats>> BuildIncrementalStats();
+	static void SnapshotIncrementalCounts(FIncrementalCountsSnapshot& OutCounts);
+	static TArray<TSharedPtr<FObjectClassStats>> BuildStatsFromCounts(const FIncrementalCountsSnapshot& Counts);
+	static void AcquireIncrementalTracking();
+	static void ReleaseIncrementalTracking();
+	
+	static TSharedPtr<FObjectProfilerSession> DefaultSession;
 	static FAsyncCollectionState AsyncState;
+	static TArray<FQueuedCollection> QueuedCollections;
 	static bool bCancellationRequested;
+	static ECollectionConsistency CollectionConsistency;
+	static ECollectionSizing CollectionSizing;
+	static EResourceSizeMode::Type ResourceSizeMode;
 	
-	static FTSTicker::FDelegateHandle RealTimeTickerHandle;
-	static float RealTimeIntervalSeconds;
-	static bool bRealTimeMonitoringActive;
-	static double LastRealTimeUpdateTime;
+	static FCriticalSection JournalLock;
+	static TArray<FJournalEntry> JournalEntries;
+	static TMap<int32, int32> JournalOpenEntries;
+	static TBitArray<> JournalCountedIndices;
+	static FJournalCreateListener* JournalCreateListener;
+	static FJournalDeleteListener* JournalDeleteListener;
 	
-	static int32 LeakDetectionThreshold;
-	
-	static FOnRealTimeUpdate RealTimeUpdateDelegate;
-	static FOnSnapshotTaken SnapshotTakenDelegate;
+	static TArray<FPendingHeapWalk> PendingHeapWalks;
+	static FTSTicker::FDelegateHandle HeapWalkTickerHandle;
+	static TArray<FLargestObjectEntry> LatestLargestObjects;
 	
 	static FCriticalSection IncrementalDataLock;
 	static TMap<UClass*, FIncrementalClassData> IncrementalClassCounts;
+	static TMap<TObjectKey<UClass>, TSharedPtr<const FIncrementalClassInfo, ESPMode::ThreadSafe>> IncrementalClassInfos;
 	static bool bIncrementalTrackingActive;
+	static int32 IncrementalTrackingUsers;
 	static FProfilerCreateListener* CreateListener;
 	static FProfilerDeleteListener* DeleteListener;
+	static TArray<uint16> ObjectWorldSlots;
+	static TArray<TWeakObjectPtr<UWorld>> WorldSlots;
+	static TMap<FObjectKey, uint16> WorldSlotLookup;
+	static TMap<FObjectKey, UWorld*> IncrementalOuterToWorld;
+	
+	static FDelegateHandle PostGarbageCollectHandle;
 	
 	static constexpr int32 EnumerationChunkSize = 1000;
 	static constexpr int32 ProcessingChunkSize = 200;
-	static constexpr int32 MaxSnapshotHistory = 50;
+	static constexpr int32 CountingChunkSize = 2000;
+	static constexpr double SizingBudgetSeconds = 0.004;
+	static constexpr int32 PartialResultsMaxClasses = 500;
+	static constexpr double PartialResultsIntervalSeconds = 0.25;
 };
\ No newline at end of file
@@ -0,0 +1,55 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+
+struct FDuplicateCluster
+{
+	FString ClassName;
+	uint64 ContentHash = 0;
+	int64 SizeBytes = 0;
+	TArray<FString> ObjectPaths;
+
+	int64 GetWastedBytes() const
+	{
+		return SizeBytes * FMath::Max(0, ObjectPaths.Num() - 1);
+	}
+};
+
+DECLARE_DELEGATE_OneParam(FOnDuplicateScanComplete, const TArray<FDuplicateCluster>&);
+
+class OBJECTPROFILEREDITOR_API FObjectProfilerDuplicateDetector
+{
+public:
+	static bool Start(const TArray<UClass*>& Classes, FOnDuplicateScanComplete OnComplete);
+	static void Cancel();
+	static bool IsRunning();
+	static float GetProgress();
+
+private:
+	struct FPendingCluster
+	{
+		FString ClassName;
+		int64 SizeBytes = 0;
+		TArray<int32> Members;
+	};
+
+	class FContentWriter;
+
+	static bool OnTick(float DeltaTime);
+	static void SerializeContent(UObject* Object, TArray<uint8>& OutBuffer);
+	static void Finish();
+
+	static TArray<TWeakObjectPtr<UObject>> PendingObjects;
+	static int32 NextObjectIndex;
+	static TMap<TPair<FObjectKey, uint64>, FPendingCluster> Clusters;
+	static FOnDuplicateScanComplete CompletionDelegate;
+	static FTSTicker::FDelegateHandle TickerHandle;
+
+	static constexpr double TickBudgetSeconds = 0.008;
+	static constexpr int32 MaxObjectsPerTick = 256;
+	static constexpr int64 MaxBytesPerTick = 32 * 1024 * 1024;
+};
\ No newline at end of file
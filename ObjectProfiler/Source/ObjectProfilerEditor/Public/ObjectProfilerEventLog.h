@@ -0,0 +1,113 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/UObjectArray.h"
+#include "ObjectProfilerTypes.h"
+
+class IFileHandle;
+
+enum class EObjectEventType : uint8
+{
+	ClassDefinition,
+	Created,
+	Deleted
+};
+
+// Event layout: varint (DeltaCycles << 2 | Type), then varints ClassId, ObjectIndex, SerialNumber.
+// Baseline events for objects alive when recording starts carry a zero delta, so they sit at time 0.
+class OBJECTPROFILEREDITOR_API FObjectEventRecorder
+{
+public:
+	static bool StartRecording(const FString& FilePath = TEXT(""));
+	static void StopRecording();
+	static bool IsRecording();
+
+	static FString GetRecordingPath();
+	static int64 GetRecordedEventCount();
+	static int64 GetRecordedBytes();
+	static FString GetDefaultRecordingDirectory();
+
+private:
+	class FRecorderCreateListener : public FUObjectArray::FUObjectCreateListener
+	{
+	public:
+		virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+		virtual void OnUObjectArrayShutdown() override;
+	};
+
+	class FRecorderDeleteListener : public FUObjectArray::FUObjectDeleteListener
+	{
+	public:
+		virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+		virtual void OnUObjectArrayShutdown() override;
+	};
+
+	static void AppendEvent(EObjectEventType Type, const UObjectBase* Object, int32 Index);
+	static void WriteEvent(EObjectEventType Type, const UObjectBase* Object, int32 Index, uint64 DeltaCycles);
+	static uint32 GetOrAssignClassId(const UClass* InClass);
+	static void RetireActiveBuffer();
+	static void WritePendingBuffers();
+	static bool OnFlushTick(float DeltaTime);
+
+	static FCriticalSection BufferLock;
+	static TArray<uint8> ActiveBuffer;
+	static TArray<TArray<uint8>> PendingBuffers;
+	static TArray<TArray<uint8>> SpareBuffers;
+	static TMap<const UClass*, uint32> ClassIds;
+	static const UClass* LastClass;
+	static uint32 LastClassId;
+	static uint64 LastEventCycles;
+	static int64 EventCount;
+	static int64 BytesWritten;
+
+	static IFileHandle* FileHandle;
+	static FString RecordingPath;
+	static bool bRecording;
+
+	static FRecorderCreateListener* CreateListener;
+	static FRecorderDeleteListener* DeleteListener;
+	static FTSTicker::FDelegateHandle FlushTickerHandle;
+
+	static constexpr int32 BufferCapacity = 1024 * 1024;
+	static constexpr int32 MaxSpareBuffers = 2;
+	static constexpr float FlushIntervalSeconds = 0.5f;
+};
+
+class OBJECTPROFILEREDITOR_API FObjectEventReplay
+{
+public:
+	bool LoadFromFile(const FString& FilePath);
+	void Reset();
+
+	bool IsLoaded() const { return bLoaded; }
+	int64 GetNumEvents() const { return EventCycles.Num(); }
+	double GetDuration() const;
+	FDateTime GetRecordingStartTime() const { return RecordingStartTime; }
+	const TArray<FString>& GetClassNames() const { return ClassNames; }
+
+	TMap<FString, int32> GetClassCountsAt(double Seconds) const;
+	TArray<FObjectHistoryPoint> GetClassCountOverTime(const FString& ClassName, double StartSeconds, double EndSeconds, int32 NumPoints) const;
+	TArray<TSharedPtr<FObjectClassStats>> Diff(double SecondsA, double SecondsB) const;
+	FObjectSnapshot BuildSnapshotAt(double Seconds, const FString& SnapshotName) const;
+
+private:
+	int32 FindEventIndexAt(double Seconds) const;
+	void ComputeCountsAt(int32 EventIndex, TArray<int32>& OutCounts) const;
+	double CyclesToSeconds(uint64 Cycles) const;
+
+	TArray<uint64> EventCycles;
+	TArray<uint32> EventClassAndType;
+	TArray<FString> ClassNames;
+	TMap<FString, int32> ClassNameToId;
+	TArray<TArray<int32>> Checkpoints;
+
+	uint64 StartCycles = 0;
+	double SecondsPerCycle = 0.0;
+	FDateTime RecordingStartTime;
+	bool bLoaded = false;
+
+	static constexpr int32 CheckpointShift = 17;
+};
\ No newline at end of file
@@ -0,0 +1,79 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+enum class EProfilerCostBucket : uint8
+{
+	Listeners,
+	AsyncCollection,
+	RealTime,
+	UserInterface,
+	Num
+};
+
+class OBJECTPROFILEREDITOR_API FObjectProfilerGovernor
+{
+public:
+	static void Start();
+	static void Stop();
+
+	static void SetBudgetPercent(float Percent);
+	static float GetBudgetPercent();
+	static bool IsEnabled();
+
+	static void AddCost(EProfilerCostBucket Bucket, uint64 Cycles);
+
+	static int32 GetThrottleLevel();
+	static float GetIntervalScale();
+	static int32 ScaleWorkChunk(int32 ChunkSize);
+	static double ScaleWorkBudget(double BudgetSeconds);
+	static bool ShouldDeferSizing();
+
+	static float GetSmoothedCostPercent();
+	static FString GetStatusText();
+
+private:
+	static bool OnFrameTick(float DeltaTime);
+	static void SetThrottleLevel(int32 NewLevel);
+
+	static std::atomic<uint64> PendingCycles[static_cast<int32>(EProfilerCostBucket::Num)];
+	static double SmoothedShare[static_cast<int32>(EProfilerCostBucket::Num)];
+	static double SmoothedTotalShare;
+
+	static float BudgetPercent;
+	static int32 ThrottleLevel;
+	static double LastLevelChangeTime;
+	static FTSTicker::FDelegateHandle FrameTickerHandle;
+
+	static constexpr int32 MaxThrottleLevel = 3;
+	static constexpr int32 DeferSizingLevel = 2;
+	static constexpr int32 MinWorkChunk = 50;
+	static constexpr double SmoothingFactor = 0.1;
+	static constexpr double EscalateDelaySeconds = 1.0;
+	static constexpr double RelaxDelaySeconds = 3.0;
+	static constexpr double RelaxHeadroom = 0.5;
+	static constexpr float DefaultBudgetPercent = 2.0f;
+};
+
+class FScopedProfilerCost
+{
+public:
+	explicit FScopedProfilerCost(EProfilerCostBucket InBucket)
+		: Bucket(InBucket)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FScopedProfilerCost()
+	{
+		FObjectProfilerGovernor::AddCost(Bucket, FPlatformTime::Cycles64() - StartCycles);
+	}
+
+private:
+	EProfilerCostBucket Bucket;
+	uint64 StartCycles;
+};
\ No newline at end of file
@@ -0,0 +1,52 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ObjectProfilerTypes.h"
+
+struct FClassLayoutGap
+{
+	FString AfterProperty;
+	int32 Offset = 0;
+	int32 Size = 0;
+	bool bUnreflected = false;
+};
+
+struct FClassLayoutReport
+{
+	FString ClassName;
+	int32 InstanceCount = 0;
+	int32 PropertiesSize = 0;
+	int32 MinAlignment = 0;
+	int32 AllocationSize = 0;
+	bool bAllocationMeasured = false;
+	int32 PaddingBytes = 0;
+	int32 BinWasteBytes = 0;
+	int32 ReorderSavingBytes = 0;
+	TArray<FClassLayoutGap> Gaps;
+	TArray<FString> SuggestedOrder;
+
+	int64 GetWastePerInstance() const
+	{
+		return PaddingBytes + BinWasteBytes;
+	}
+
+	int64 GetTotalWasteBytes() const
+	{
+		return GetWastePerInstance() * InstanceCount;
+	}
+};
+
+class OBJECTPROFILEREDITOR_API FObjectProfilerLayoutAnalyzer
+{
+public:
+	static constexpr int32 DefaultMinInstanceCount = 1000;
+
+	static TArray<FClassLayoutReport> Analyze(const TArray<TSharedPtr<FObjectClassStats>>& Stats, int32 MinInstanceCount = DefaultMinInstanceCount);
+
+private:
+	static void FindPaddingGaps(const UClass* Class, FClassLayoutReport& OutReport);
+	static void MeasureAllocation(const FObjectClassStats& Stats, FClassLayoutReport& OutReport);
+	static void SuggestOrdering(const UClass* Class, FClassLayoutReport& OutReport);
+};
\ No newline at end of file
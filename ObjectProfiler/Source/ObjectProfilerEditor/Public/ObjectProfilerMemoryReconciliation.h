@@ -0,0 +1,51 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ObjectProfilerTypes.h"
+
+struct FMemoryReconciliationSample
+{
+	double Timestamp = 0.0;
+	int64 ProcessPhysicalBytes = 0;
+	int64 ProcessVirtualBytes = 0;
+	int64 AttributedBytes = 0;
+	int64 AttributedVideoBytes = 0;
+	TMap<EObjectCategory, int64> CategoryBytes;
+
+	bool bHasLLM = false;
+	int64 LLMTrackedBytes = 0;
+	int64 LLMUObjectBytes = 0;
+	TMap<EObjectCategory, int64> LLMCategoryBytes;
+
+	int64 GetResidentAttributedBytes() const
+	{
+		return AttributedBytes - AttributedVideoBytes;
+	}
+
+	int64 GetUnattributedBytes() const
+	{
+		return ProcessPhysicalBytes - GetResidentAttributedBytes();
+	}
+};
+
+class OBJECTPROFILEREDITOR_API FObjectProfilerMemoryReconciliation
+{
+public:
+	static void RecordSample(const TArray<TSharedPtr<FObjectClassStats>>& Stats);
+	static void RecordSample(const FObjectSnapshot& Snapshot);
+	static void ClearSamples();
+
+	static const TArray<FMemoryReconciliationSample>& GetSamples();
+	static const FMemoryReconciliationSample* GetLatestCategorySample();
+	static bool IsLLMAvailable();
+
+private:
+	static void CaptureProcessTotals(FMemoryReconciliationSample& Sample);
+	static void AddSample(FMemoryReconciliationSample&& Sample);
+
+	static TArray<FMemoryReconciliationSample> Samples;
+
+	static constexpr int32 MaxSamples = 120;
+};
\ No newline at end of file
@@ -0,0 +1,51 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class FProperty;
+
+struct FPropertyMemoryNode : public TSharedFromThis<FPropertyMemoryNode>
+{
+	FString Name;
+	FString TypeName;
+	int64 InlineBytes = 0;
+	int64 TotalBytes = 0;
+	TArray<TSharedPtr<FPropertyMemoryNode>> Children;
+
+	int64 GetHeapBytes() const
+	{
+		return TotalBytes - InlineBytes;
+	}
+};
+
+class OBJECTPROFILEREDITOR_API FObjectProfilerPropertyBreakdown
+{
+public:
+	static TSharedPtr<FPropertyMemoryNode> GetBreakdown(UObject* Object, bool bForceRebuild = false);
+	static void ClearCache();
+
+private:
+	struct FBuildContext
+	{
+		const UObject* Root = nullptr;
+		TSet<const UObject*> VisitedObjects;
+	};
+
+	static TSharedPtr<FPropertyMemoryNode> BuildObjectNode(UObject* Object, int32 Depth, FBuildContext& Context);
+	static TSharedPtr<FPropertyMemoryNode> BuildValueNode(const FProperty* Property, const void* ValuePtr, const FString& Name, int32 Depth, FBuildContext& Context);
+	static void AddStructChildren(const UStruct* Struct, const void* Container, int32 Depth, FBuildContext& Context, FPropertyMemoryNode& Parent);
+	static void AddElementChild(const FProperty* Property, const void* ValuePtr, const FString& Name, int32 Depth, FBuildContext& Context, FPropertyMemoryNode& Parent);
+	static int32 GetValueSize(const FProperty* Property);
+	static FString DescribeKey(const FProperty* KeyProperty, const void* KeyPtr);
+	static void TrimChildren(FPropertyMemoryNode& Node);
+
+	static TMap<FObjectKey, TSharedPtr<FPropertyMemoryNode>> Cache;
+
+	static constexpr int32 MaxDepth = 6;
+	static constexpr int32 MaxChildren = 32;
+	static constexpr int32 MaxCachedObjects = 64;
+	static constexpr int32 MaxKeyLength = 48;
+};
\ No newline at end of file
@@ -0,0 +1,92 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "ObjectProfilerCore.h"
+
+class OBJECTPROFILEREDITOR_API FObjectProfilerSession : public TSharedFromThis<FObjectProfilerSession>
+{
+public:
+	explicit FObjectProfilerSession(const FString& InName, const FProfilerCollectionScope& InScope = FProfilerCollectionScope());
+	~FObjectProfilerSession();
+
+	const FString& GetName() const { return Name; }
+	const FProfilerCollectionScope& GetScope() const { return Scope; }
+	void SetScope(const FProfilerCollectionScope& InScope);
+
+	void Refresh(int32 MaxSamplesPerClass, FOnObjectStatsCollected OnComplete);
+	TArray<TSharedPtr<FObjectClassStats>> CollectNow(int32 MaxSamplesPerClass = 5, bool bShowProgress = false);
+	void CollectAsync(int32 MaxSamplesPerClass, FOnObjectStatsCollected OnComplete, FOnCollectionProgress OnProgress = FOnCollectionProgress(), FOnPartialResults OnPartialResults = FOnPartialResults());
+	void ApplyHistory(TArray<TSharedPtr<FObjectClassStats>>& InStats, bool bSizesMeasured);
+	void ApplyHistory(TArray<TSharedPtr<FObjectClassStats>>& InStats, bool bSizesMeasured, const FProfilerCollectionScope& HistoryScope);
+	TSharedPtr<FObjectClassStats> FindPreviousStats(const FString& ClassName) const;
+	TSharedPtr<FObjectClassStats> FindPreviousStats(const FString& ClassName, const FProfilerCollectionScope& HistoryScope) const;
+
+	void TakeSnapshot(const FString& SnapshotName = TEXT(""));
+	void RequestSnapshot(const FString& SnapshotName = TEXT(""));
+	TArray<TSharedPtr<FObjectClassStats>> GetDeltaSinceSnapshot(int32 SnapshotIndex = -1);
+	TArray<TSharedPtr<FObjectClassStats>> CompareTwoSnapshots(int32 IndexA, int32 IndexB) const;
+
+	const TArray<FObjectSnapshot>& GetSnapshotHistory() const { return SnapshotHistory; }
+	void AddSnapshot(const FObjectSnapshot& Snapshot);
+	void ClearSnapshotHistory();
+	void DeleteSnapshot(int32 Index);
+	bool SaveSnapshotsToFile(const FString& FilePath) const;
+	bool LoadSnapshotsFromFile(const FString& FilePath);
+
+	void StartRealTimeMonitoring(float IntervalSeconds);
+	void StopRealTimeMonitoring();
+	bool IsRealTimeMonitoringActive() const { return bRealTimeMonitoringActive; }
+	void SetRealTimeInterval(float IntervalSeconds);
+	float GetRealTimeInterval() const { return RealTimeIntervalSeconds; }
+	TArray<TSharedPtr<FObjectClassStats>> UpdateFromIncrementalCounts();
+
+	void SetLeakDetectionThreshold(int32 ConsecutiveTicks);
+	int32 GetLeakDetectionThreshold() const { return LeakDetectionThreshold; }
+
+	FOnRealTimeUpdate& OnRealTimeUpdate() { return RealTimeUpdateDelegate; }
+	FOnSnapshotTaken& OnSnapshotTaken() { return SnapshotTakenDelegate; }
+
+private:
+	friend class FObjectProfilerCore;
+
+	void TakeScopedSnapshot(const FString& SnapshotName, const FProfilerCollectionScope& SnapshotScope);
+	void RequestScopedSnapshot(const FString& SnapshotName, const FProfilerCollectionScope& SnapshotScope);
+	void RecordSnapshot(FObjectSnapshot& Snapshot, const FString& SnapshotName);
+	TArray<TSharedPtr<FObjectClassStats>> CopyScopedStats(const TMap<UClass*, TSharedPtr<FObjectClassStats>>& ClassStats) const;
+	
+	static FString MakeHistoryKey(const FProfilerCollectionScope& InScope);
+	FString GetScopeHistoryKey() const;
+	void ApplyHistoryForKey(TArray<TSharedPtr<FObjectClassStats>>& InStats, bool bSizesMeasured, const FString& HistoryKey);
+	TMap<FString, TSharedPtr<FObjectClassStats>>& FindOrAddHistory(const FString& HistoryKey);
+	const TMap<FString, TSharedPtr<FObjectClassStats>>* FindHistory(const FString& HistoryKey) const;
+
+	bool OnRealTimeTick(float DeltaTime);
+	void UpdateRealTimeStats();
+	void OnRealTimeStatsBuilt(TArray<TSharedPtr<FObjectClassStats>> Results);
+
+	FString Name;
+	FProfilerCollectionScope Scope;
+	FString ScopeHistoryKey;
+
+	TArray<FObjectSnapshot> SnapshotHistory;
+	TMap<FString, TSharedPtr<FObjectClassStats>> PreviousStats;
+	TMap<FString, TMap<FString, TSharedPtr<FObjectClassStats>>> ForeignScopeStats;
+	mutable FCriticalSection HistoryLock;
+	EResourceSizeMode::Type HistorySizeMode = EResourceSizeMode::EstimatedTotal;
+	int32 LeakDetectionThreshold = 5;
+
+	FTSTicker::FDelegateHandle RealTimeTickerHandle;
+	float RealTimeIntervalSeconds = 1.0f;
+	bool bRealTimeMonitoringActive = false;
+	double LastRealTimeUpdateTime = 0.0;
+	bool bRealTimeBuildInFlight = false;
+
+	FOnRealTimeUpdate RealTimeUpdateDelegate;
+	FOnSnapshotTaken SnapshotTakenDelegate;
+
+	static constexpr int32 MaxSnapshotHistory = 50;
+	static constexpr int32 MaxForeignScopeHistories = 8;
+};
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/WeakObjectPtrTemplates.h"
+#include "UObject/ObjectKey.h"
 
 UENUM()
 enum class EObjectCategory : uint8
@@ -52,9 +53,42 @@ enum class EProfilerGroupMode : uint8
 {
 	None,
 	ByModule,
-	ByCategory
+	ByCategory,
+	ByWorld,
+	ByClassHierarchy,
+	BySource,
+	ByPackage,
+	ByOuter
 };
 
+UENUM()
+enum class ECollectionConsistency : uint8
+{
+	CollectionStart,
+	CollectionEnd
+};
+
+UENUM()
+enum class ECollectionSizing : uint8
+{
+	Inline,
+	Deferred
+};
+
+UENUM()
+enum class EHeapWalkNeeds : uint8
+{
+	None = 0,
+	Counts = 1 << 0,
+	Sizes = 1 << 1,
+	Samples = 1 << 2,
+	Instances = 1 << 3,
+	CategoryBreakdown = 1 << 4,
+	ModuleBreakdown = 1 << 5,
+	ActorFootprint = 1 << 6
+};
+ENUM_CLASS_FLAGS(EHeapWalkNeeds);
+
 UENUM()
 enum class ESizeFilterMode : uint8
 {
@@ -70,9 +104,249 @@ struct FObjectHistoryPoint
 {
 	int32 InstanceCount = 0;
 	int64 TotalSizeBytes = 0;
+	int32 RetainedCount = INDEX_NONE;
 	double Timestamp = 0.0;
 };
 
+struct FObjectFlagCensus
+{
+	int32 RootSet = 0;
+	int32 Transient = 0;
+	int32 TransientPackage = 0;
+	int32 Garbage = 0;
+	int32 AsyncLoading = 0;
+	int32 Standalone = 0;
+	int32 Public = 0;
+	
+	int32 GetRetainedCount() const
+	{
+		return RootSet + TransientPackage;
+	}
+	
+	bool IsEmpty() const
+	{
+		return RootSet == 0 && Transient == 0 && TransientPackage == 0 && Garbage == 0 && AsyncLoading == 0 && Standalone == 0 && Public == 0;
+	}
+};
+
+struct FObjectWorldStats
+{
+	int32 InstanceCount = 0;
+	int32 DeltaCount = 0;
+	int64 TotalSizeBytes = 0;
+};
+
+struct FObjectSizeBreakdown
+{
+	int64 SystemBytes = 0;
+	int64 VideoBytes = 0;
+	int64 UnknownBytes = 0;
+	
+	int64 GetTotal() const
+	{
+		return SystemBytes + VideoBytes + UnknownBytes;
+	}
+	
+	void Add(const FObjectSizeBreakdown& Other, int32 Sign = 1)
+	{
+		SystemBytes += Other.SystemBytes * Sign;
+		VideoBytes += Other.VideoBytes * Sign;
+		UnknownBytes += Other.UnknownBytes * Sign;
+	}
+	
+	FObjectSizeBreakdown operator-(const FObjectSizeBreakdown& Other) const
+	{
+		FObjectSizeBreakdown Result = *this;
+		Result.Add(Other, -1);
+		return Result;
+	}
+};
+
+struct FObjectSizeSample
+{
+	FString ObjectPath;
+	int64 SizeBytes = 0;
+};
+
+struct FObjectSizeDistribution
+{
+	static constexpr int32 NumBuckets = 40;
+	static constexpr int32 MaxLargestInstances = 10;
+	
+	int32 BucketCounts[NumBuckets] = {};
+	int64 MaxSizeBytes = 0;
+	TArray<FObjectSizeSample> LargestInstances;
+	
+	static int32 GetBucketIndex(int64 SizeBytes)
+	{
+		return SizeBytes <= 0 ? 0 : FMath::Min(NumBuckets - 1, static_cast<int32>(FMath::FloorLog2_64(static_cast<uint64>(SizeBytes))) + 1);
+	}
+	
+	static int64 GetBucketLowerBound(int32 BucketIndex)
+	{
+		return BucketIndex <= 0 ? 0 : (int64(1) << (BucketIndex - 1));
+	}
+	
+	static int64 GetBucketUpperBound(int32 BucketIndex)
+	{
+		return BucketIndex <= 0 ? 0 : (int64(1) << BucketIndex) - 1;
+	}
+	
+	void AddSample(int64 SizeBytes, int32 Sign)
+	{
+		BucketCounts[GetBucketIndex(SizeBytes)] += Sign;
+		if (Sign > 0)
+		{
+			MaxSizeBytes = FMath::Max(MaxSizeBytes, SizeBytes);
+		}
+	}
+	
+	bool WouldKeepInstance(int64 SizeBytes) const
+	{
+		return LargestInstances.Num() < MaxLargestInstances || SizeBytes > LargestInstances.HeapTop().SizeBytes;
+	}
+	
+	void OfferInstance(FString&& ObjectPath, int64 SizeBytes)
+	{
+		auto ByAscendingSize = [](const FObjectSizeSample& A, const FObjectSizeSample& B) { return A.SizeBytes < B.SizeBytes; };
+		
+		LargestInstances.HeapPush(FObjectSizeSample{MoveTemp(ObjectPath), SizeBytes}, ByAscendingSize);
+		if (LargestInstances.Num() > MaxLargestInstances)
+		{
+			LargestInstances.HeapPopDiscard(ByAscendingSize);
+		}
+	}
+	
+	void RemoveInstance(const FString& ObjectPath)
+	{
+		const int32 Index = LargestInstances.IndexOfByPredicate([&ObjectPath](const FObjectSizeSample& Sample) { return Sample.ObjectPath == ObjectPath; });
+		if (Index != INDEX_NONE)
+		{
+			LargestInstances.RemoveAtSwap(Index, 1);
+			LargestInstances.Heapify([](const FObjectSizeSample& A, const FObjectSizeSample& B) { return A.SizeBytes < B.SizeBytes; });
+		}
+	}
+	
+	int32 GetSampleCount() const
+	{
+		int32 Total = 0;
+		for (int32 Count : BucketCounts)
+		{
+			Total += FMath::Max(Count, 0);
+		}
+		return Total;
+	}
+	
+	int64 GetPercentile(float Fraction) const
+	{
+		const int32 SampleCount = GetSampleCount();
+		if (SampleCount == 0)
+		{
+			return 0;
+		}
+		
+		const int32 Target = FMath::Clamp(FMath::CeilToInt(Fraction * SampleCount), 1, SampleCount);
+		int32 Cumulative = 0;
+		
+		for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+		{
+			const int32 Count = FMath::Max(BucketCounts[BucketIndex], 0);
+			if (Count > 0 && Cumulative + Count >= Target)
+			{
+				const int64 Lower = GetBucketLowerBound(BucketIndex);
+				const int64 Upper = FMath::Min(GetBucketUpperBound(BucketIndex), MaxSizeBytes);
+				const double Alpha = static_cast<double>(Target - Cumulative) / Count;
+				return Lower + static_cast<int64>((FMath::Max(Upper, Lower) - Lower) * Alpha);
+			}
+			Cumulative += Count;
+		}
+		
+		return MaxSizeBytes;
+	}
+	
+	TArray<FObjectSizeSample> GetLargestSorted() const
+	{
+		TArray<FObjectSizeSample> Sorted = LargestInstances;
+		Sorted.Sort([](const FObjectSizeSample& A, const FObjectSizeSample& B) { return A.SizeBytes > B.SizeBytes; });
+		return Sorted;
+	}
+};
+
+struct FLargestObjectEntry
+{
+	FString ObjectPath;
+	FString ClassName;
+	FString OuterName;
+	FName WorldLabel;
+	int64 SizeBytes = 0;
+};
+
+struct FLargestObjectsList
+{
+	static constexpr int32 MaxEntries = 100;
+	
+	TArray<FLargestObjectEntry> Entries;
+	
+	bool WouldKeep(int64 SizeBytes) const
+	{
+		return Entries.Num() < MaxEntries || SizeBytes > Entries.HeapTop().SizeBytes;
+	}
+	
+	bool MayContain(int64 SizeBytes) const
+	{
+		return Entries.Num() > 0 && SizeBytes >= Entries.HeapTop().SizeBytes;
+	}
+	
+	void Offer(FLargestObjectEntry&& Entry)
+	{
+		auto ByAscendingSize = [](const FLargestObjectEntry& A, const FLargestObjectEntry& B) { return A.SizeBytes < B.SizeBytes; };
+		
+		Entries.HeapPush(MoveTemp(Entry), ByAscendingSize);
+		if (Entries.Num() > MaxEntries)
+		{
+			Entries.HeapPopDiscard(ByAscendingSize);
+		}
+	}
+	
+	void Remove(const FString& ObjectPath)
+	{
+		const int32 Index = Entries.IndexOfByPredicate([&ObjectPath](const FLargestObjectEntry& Entry) { return Entry.ObjectPath == ObjectPath; });
+		if (Index != INDEX_NONE)
+		{
+			Entries.RemoveAtSwap(Index, 1);
+			Entries.Heapify([](const FLargestObjectEntry& A, const FLargestObjectEntry& B) { return A.SizeBytes < B.SizeBytes; });
+		}
+	}
+	
+	TArray<FLargestObjectEntry> GetSorted() const
+	{
+		TArray<FLargestObjectEntry> Sorted = Entries;
+		Sorted.Sort([](const FLargestObjectEntry& A, const FLargestObjectEntry& B) { return A.SizeBytes > B.SizeBytes; });
+		return Sorted;
+	}
+};
+
+struct FActorFootprintEntry
+{
+	FString ClassName;
+	int32 ActorCount = 0;
+	int32 ChargedObjectCount = 0;
+	int64 OwnSizeBytes = 0;
+	int64 TotalSizeBytes = 0;
+	int64 MaxActorSizeBytes = 0;
+	FString LargestActorPath;
+	
+	int64 GetAverageSizeBytes() const
+	{
+		return ActorCount > 0 ? TotalSizeBytes / ActorCount : 0;
+	}
+	
+	float GetObjectsPerActor() const
+	{
+		return ActorCount > 0 ? static_cast<float>(ChargedObjectCount) / ActorCount : 0.0f;
+	}
+};
+
 struct FObjectClassStats : public TSharedFromThis<FObjectClassStats>
 {
 	FString ClassName;
@@ -89,10 +363,29 @@ struct FObjectClassStats : public TSharedFromThis<FObjectClassStats>
 	EObjectCategory Category = EObjectCategory::Unknown;
 	EObjectSource Source = EObjectSource::Unknown;
 	bool bSizeAvailable = true;
+	bool bSizePending = false;
 	bool bIsLeaking = false;
 	bool bIsHot = false;
 	int32 ConsecutiveGrowthTicks = 0;
 	
+	int32 InclusiveInstanceCount = 0;
+	int32 InclusiveDeltaCount = 0;
+	int64 InclusiveSizeBytes = 0;
+	FObjectSizeBreakdown InclusiveSizeBreakdown;
+	FObjectSizeBreakdown InclusiveDeltaSizeBreakdown;
+	TSharedPtr<FObjectClassStats> SuperStats;
+	
+	FObjectSizeDistribution SizeDistribution;
+	FObjectSizeBreakdown SizeBreakdown;
+	FObjectSizeBreakdown DeltaSizeBreakdown;
+	TMap<FName, FObjectWorldStats> WorldStats;
+	TMap<FName, FObjectWorldStats> PackageStats;
+	TMap<FObjectKey, FObjectWorldStats> OuterStats;
+	
+	FObjectFlagCensus FlagCensus;
+	bool bIsRetentionLeaking = false;
+	int32 ConsecutiveRetentionGrowthTicks = 0;
+	
 	TArray<FObjectHistoryPoint> History;
 	static constexpr int32 MaxHistorySize = 60;
 	
@@ -106,11 +399,28 @@ struct FObjectClassStats : public TSharedFromThis<FObjectClassStats>
 		return ClassPtr.IsValid();
 	}
 	
-	void AddHistoryPoint(int32 InCount, int64 InSize, double InTimestamp)
+	template <typename KeyType>
+	static KeyType FindDominantOwner(const TMap<KeyType, FObjectWorldStats>& OwnerStats)
+	{
+		KeyType Dominant = KeyType();
+		int32 DominantCount = 0;
+		for (const TPair<KeyType, FObjectWorldStats>& Pair : OwnerStats)
+		{
+			if (Pair.Value.InstanceCount > DominantCount)
+			{
+				Dominant = Pair.Key;
+				DominantCount = Pair.Value.InstanceCount;
+			}
+		}
+		return Dominant;
+	}
+	
+	void AddHistoryPoint(int32 InCount, int64 InSize, double InTimestamp, int32 InRetainedCount = INDEX_NONE)
 	{
 		FObjectHistoryPoint Point;
 		Point.InstanceCount = InCount;
 		Point.TotalSizeBytes = InSize;
+		Point.RetainedCount = InRetainedCount;
 		Point.Timestamp = InTimestamp;
 		
 		History.Add(Point);
@@ -125,6 +435,7 @@ struct FObjectClassStats : public TSharedFromThis<FObjectClassStats>
 		if (History.Num() < 2)
 		{
 			bIsLeaking = false;
+			bIsRetentionLeaking = false;
 			return;
 		}
 		
@@ -141,8 +452,35 @@ struct FObjectClassStats : public TSharedFromThis<FObjectClassStats>
 			}
 		}
 		
+		int32 RetentionGrowthCount = 0;
+		int32 PreviousRetained = INDEX_NONE;
+		for (const FObjectHistoryPoint& Point : History)
+		{
+			if (Point.RetainedCount == INDEX_NONE)
+			{
+				continue;
+			}
+			
+			if (PreviousRetained != INDEX_NONE)
+			{
+				RetentionGrowthCount = Point.RetainedCount > PreviousRetained ? RetentionGrowthCount + 1 : 0;
+			}
+			PreviousRetained = Point.RetainedCount;
+		}
+		
 		ConsecutiveGrowthTicks = GrowthCount;
-		bIsLeaking = GrowthCount >= ThresholdTicks;
+		ConsecutiveRetentionGrowthTicks = RetentionGrowthCount;
+		bIsRetentionLeaking = RetentionGrowthCount >= ThresholdTicks;
+		bIsLeaking = GrowthCount >= ThresholdTicks || bIsRetentionLeaking;
+	}
+	
+	void UpdateWorldDeltas(const FObjectClassStats& Previous)
+	{
+		for (TPair<FName, FObjectWorldStats>& Pair : WorldStats)
+		{
+			const FObjectWorldStats* PreviousWorld = Previous.WorldStats.Find(Pair.Key);
+			Pair.Value.DeltaCount = Pair.Value.InstanceCount - (PreviousWorld ? PreviousWorld->InstanceCount : 0);
+		}
 	}
 	
 	void CalculateRateOfChange()
@@ -181,8 +519,10 @@ struct FObjectSnapshot
 	FDateTime Timestamp;
 	TMap<FString, int32> ClassCounts;
 	TMap<FString, int64> ClassSizes;
+	TArray<FLargestObjectEntry> LargestObjects;
 	int32 TotalObjects = 0;
 	int64 TotalSize = 0;
+	int64 VideoSize = 0;
 	
 	FString GetDisplayName() const
 	{
@@ -218,6 +558,51 @@ struct FProfilerFilterSettings
 	}
 };
 
+struct FProfilerCollectionScope
+{
+	TArray<FString> PackagePrefixes;
+	TWeakObjectPtr<UWorld> World;
+	TWeakObjectPtr<UObject> Outer;
+	
+	bool IsEmpty() const
+	{
+		return PackagePrefixes.Num() == 0 && World.IsExplicitlyNull() && Outer.IsExplicitlyNull();
+	}
+};
+
+struct FHeapWalkRequest
+{
+	EHeapWalkNeeds Needs = EHeapWalkNeeds::None;
+	TSet<const UClass*> InstanceClasses;
+	TSet<FName> InstanceClassNames;
+	int32 MaxSamplesPerClass = 5;
+	bool bShowProgress = false;
+	
+	void Merge(const FHeapWalkRequest& Other)
+	{
+		Needs |= Other.Needs;
+		InstanceClasses.Append(Other.InstanceClasses);
+		InstanceClassNames.Append(Other.InstanceClassNames);
+		MaxSamplesPerClass = FMath::Max(MaxSamplesPerClass, Other.MaxSamplesPerClass);
+		bShowProgress |= Other.bShowProgress;
+	}
+};
+
+struct FHeapWalkResult
+{
+	TMap<UClass*, TSharedPtr<FObjectClassStats>> ClassStats;
+	TMap<const UClass*, TArray<FString>> InstancesByClass;
+	TMap<FName, TArray<FString>> InstancesByClassName;
+	TMap<EObjectCategory, int64> CategorySizes;
+	TMap<FString, int64> ModuleSizes;
+	FLargestObjectsList LargestObjects;
+	TArray<FActorFootprintEntry> ActorFootprints;
+	int32 TotalObjects = 0;
+	int64 TotalSize = 0;
+	int32 NumConsumers = 0;
+	bool bCancelled = false;
+};
+
 struct FFilterPreset
 {
 	FString Name;
@@ -229,8 +614,12 @@ struct FProfilerTreeItem : public TSharedFromThis<FProfilerTreeItem>
 	enum class EItemType : uint8
 	{
 		Root,
+		Source,
 		Module,
 		Category,
+		World,
+		Package,
+		Outer,
 		Class
 	};
 	
@@ -240,12 +629,57 @@ struct FProfilerTreeItem : public TSharedFromThis<FProfilerTreeItem>
 	TArray<TSharedPtr<FProfilerTreeItem>> Children;
 	TWeakPtr<FProfilerTreeItem> Parent;
 	bool bIsExpanded = false;
+	bool bInclusiveTotals = false;
+	
+	int32 CachedInstanceCount = 0;
+	int64 CachedSize = 0;
+	FObjectSizeBreakdown CachedSizeBreakdown;
+	FObjectSizeBreakdown CachedDeltaSizeBreakdown;
+	bool bCachedLeaking = false;
+	bool bCachedHot = false;
+	bool bAggregatesCached = false;
+	
+	void CacheAggregates()
+	{
+		CachedInstanceCount = 0;
+		CachedSize = 0;
+		CachedSizeBreakdown = FObjectSizeBreakdown();
+		CachedDeltaSizeBreakdown = FObjectSizeBreakdown();
+		bCachedLeaking = Stats.IsValid() && Stats->bIsLeaking;
+		bCachedHot = Stats.IsValid() && Stats->bIsHot;
+		
+		for (const auto& Child : Children)
+		{
+			Child->CacheAggregates();
+			CachedInstanceCount += Child->CachedInstanceCount;
+			CachedSize += Child->CachedSize;
+			CachedSizeBreakdown.Add(Child->CachedSizeBreakdown);
+			CachedDeltaSizeBreakdown.Add(Child->CachedDeltaSizeBreakdown);
+			bCachedLeaking |= Child->bCachedLeaking;
+			bCachedHot |= Child->bCachedHot;
+		}
+		
+		if (Stats.IsValid())
+		{
+			CachedInstanceCount = bInclusiveTotals ? Stats->InclusiveInstanceCount : Stats->InstanceCount;
+			CachedSize = bInclusiveTotals ? Stats->InclusiveSizeBytes : Stats->TotalSizeBytes;
+			CachedSizeBreakdown = bInclusiveTotals ? Stats->InclusiveSizeBreakdown : Stats->SizeBreakdown;
+			CachedDeltaSizeBreakdown = bInclusiveTotals ? Stats->InclusiveDeltaSizeBreakdown : Stats->DeltaSizeBreakdown;
+		}
+		
+		bAggregatesCached = true;
+	}
 	
 	int32 GetAggregatedInstanceCount() const
 	{
+		if (bAggregatesCached)
+		{
+			return CachedInstanceCount;
+		}
+		
 		if (Stats.IsValid())
 		{
-			return Stats->InstanceCount;
+			return bInclusiveTotals ? Stats->InclusiveInstanceCount : Stats->InstanceCount;
 		}
 		
 		int32 Total = 0;
@@ -258,9 +692,14 @@ struct FProfilerTreeItem : public TSharedFromThis<FProfilerTreeItem>
 	
 	int64 GetAggregatedSize() const
 	{
+		if (bAggregatesCached)
+		{
+			return CachedSize;
+		}
+		
 		if (Stats.IsValid())
 		{
-			return Stats->TotalSizeBytes;
+			return bInclusiveTotals ? Stats->InclusiveSizeBytes : Stats->TotalSizeBytes;
 		}
 		
 		int64 Total = 0;
@@ -271,11 +710,40 @@ struct FProfilerTreeItem : public TSharedFromThis<FProfilerTreeItem>
 		return Total;
 	}
 	
-	bool HasLeakingChildren() const
+	FObjectSizeBreakdown GetAggregatedSizeBreakdown(bool bDelta = false) const
 	{
+		if (bAggregatesCached)
+		{
+			return bDelta ? CachedDeltaSizeBreakdown : CachedSizeBreakdown;
+		}
+		
 		if (Stats.IsValid())
 		{
-			return Stats->bIsLeaking;
+			if (bInclusiveTotals)
+			{
+				return bDelta ? Stats->InclusiveDeltaSizeBreakdown : Stats->InclusiveSizeBreakdown;
+			}
+			return bDelta ? Stats->DeltaSizeBreakdown : Stats->SizeBreakdown;
+		}
+		
+		FObjectSizeBreakdown Total;
+		for (const auto& Child : Children)
+		{
+			Total.Add(Child->GetAggregatedSizeBreakdown(bDelta));
+		}
+		return Total;
+	}
+	
+	bool HasLeakingChildren() const
+	{
+		if (bAggregatesCached)
+		{
+			return bCachedLeaking;
+		}
+		
+		if (Stats.IsValid() && Stats->bIsLeaking)
+		{
+			return true;
 		}
 		
 		for (const auto& Child : Children)
@@ -290,9 +758,14 @@ struct FProfilerTreeItem : public TSharedFromThis<FProfilerTreeItem>
 	
 	bool HasHotChildren() const
 	{
-		if (Stats.IsValid())
+		if (bAggregatesCached)
+		{
+			return bCachedHot;
+		}
+		
+		if (Stats.IsValid() && Stats->bIsHot)
 		{
-			return Stats->bIsHot;
+			return true;
 		}
 		
 		for (const auto& Child : Children)
@@ -0,0 +1,55 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "ObjectProfilerTypes.h"
+
+class SActorFootprintPanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SActorFootprintPanel) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	TSharedRef<ITableRow> OnGenerateRowForList(TSharedPtr<FActorFootprintEntry> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnEntryDoubleClicked(TSharedPtr<FActorFootprintEntry> Item);
+
+	void OnSortColumnHeader(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type NewSortMode);
+	EColumnSortMode::Type GetSortModeForColumn(FName ColumnId) const;
+	void SortEntries();
+
+	FReply OnRefreshClicked();
+	FReply OnFindClicked();
+	bool HasSelection() const;
+	FText GetSummaryText() const;
+
+	void OnHeapWalkComplete(const FHeapWalkResult& WalkResult);
+	TSharedPtr<FActorFootprintEntry> GetSelectedEntry() const;
+
+	TSharedPtr<SListView<TSharedPtr<FActorFootprintEntry>>> EntryListView;
+	TArray<TSharedPtr<FActorFootprintEntry>> EntryItems;
+
+	FName CurrentSortColumn = "Total";
+	EColumnSortMode::Type CurrentSortMode = EColumnSortMode::Descending;
+	bool bWalkInFlight = false;
+	FText StatusMessage;
+};
+
+class SActorFootprintRow : public SMultiColumnTableRow<TSharedPtr<FActorFootprintEntry>>
+{
+public:
+	SLATE_BEGIN_ARGS(SActorFootprintRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FActorFootprintEntry>, Item)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+
+private:
+	TSharedPtr<FActorFootprintEntry> Item;
+};
\ No newline at end of file
@@ -0,0 +1,50 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "ObjectProfilerArchiveSizer.h"
+
+class SArchiveSizePanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SArchiveSizePanel) {}
+		SLATE_ARGUMENT(TArray<TSharedPtr<FObjectClassStats>>, Stats)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+	virtual ~SArchiveSizePanel() override;
+
+private:
+	TSharedRef<ITableRow> OnGenerateRowForList(TSharedPtr<FArchiveSizeEntry> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnScanComplete(const TArray<FArchiveSizeEntry>& Results);
+	void StartScan();
+
+	FReply OnCancelClicked();
+	void OnFullScanChanged(ECheckBoxState NewState);
+	FText GetSummaryText() const;
+	TOptional<float> GetProgress() const;
+
+	TSharedPtr<SListView<TSharedPtr<FArchiveSizeEntry>>> EntryListView;
+	TArray<TSharedPtr<FArchiveSizeEntry>> EntryItems;
+	TArray<TSharedPtr<FObjectClassStats>> Stats;
+	bool bFullScan = false;
+	bool bScanning = false;
+	bool bScanRejected = false;
+};
+
+class SArchiveSizeRow : public SMultiColumnTableRow<TSharedPtr<FArchiveSizeEntry>>
+{
+public:
+	SLATE_BEGIN_ARGS(SArchiveSizeRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FArchiveSizeEntry>, Item)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+
+private:
+	TSharedPtr<FArchiveSizeEntry> Item;
+};
\ No newline at end of file
@@ -0,0 +1,50 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "ObjectProfilerContainerSlack.h"
+
+class SContainerSlackPanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SContainerSlackPanel) {}
+		SLATE_ARGUMENT(TArray<UClass*>, Classes)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+	virtual ~SContainerSlackPanel() override;
+
+private:
+	TSharedRef<ITableRow> OnGenerateRowForList(TSharedPtr<FContainerSlackEntry> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnSelectionChanged(TSharedPtr<FContainerSlackEntry> Item, ESelectInfo::Type SelectInfo);
+	void OnScanComplete(const TArray<FContainerSlackEntry>& Results);
+
+	FReply OnCancelClicked();
+	FText GetSummaryText() const;
+	FText GetExamplesText() const;
+	TOptional<float> GetProgress() const;
+
+	TSharedPtr<SListView<TSharedPtr<FContainerSlackEntry>>> EntryListView;
+	TArray<TSharedPtr<FContainerSlackEntry>> EntryItems;
+	TSharedPtr<FContainerSlackEntry> SelectedEntry;
+	int32 ClassCount = 0;
+	bool bScanning = false;
+	bool bScanRejected = false;
+};
+
+class SContainerSlackRow : public SMultiColumnTableRow<TSharedPtr<FContainerSlackEntry>>
+{
+public:
+	SLATE_BEGIN_ARGS(SContainerSlackRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FContainerSlackEntry>, Item)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+
+private:
+	TSharedPtr<FContainerSlackEntry> Item;
+};
\ No newline at end of file
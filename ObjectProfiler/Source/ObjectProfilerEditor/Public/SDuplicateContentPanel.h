@@ -0,0 +1,50 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "ObjectProfilerDuplicateDetector.h"
+
+class SDuplicateContentPanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SDuplicateContentPanel) {}
+		SLATE_ARGUMENT(TArray<UClass*>, Classes)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+	virtual ~SDuplicateContentPanel() override;
+
+private:
+	TSharedRef<ITableRow> OnGenerateRowForList(TSharedPtr<FDuplicateCluster> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnSelectionChanged(TSharedPtr<FDuplicateCluster> Item, ESelectInfo::Type SelectInfo);
+	void OnScanComplete(const TArray<FDuplicateCluster>& Results);
+
+	FReply OnCancelClicked();
+	FText GetSummaryText() const;
+	FText GetMembersText() const;
+	TOptional<float> GetProgress() const;
+
+	TSharedPtr<SListView<TSharedPtr<FDuplicateCluster>>> ClusterListView;
+	TArray<TSharedPtr<FDuplicateCluster>> ClusterItems;
+	TSharedPtr<FDuplicateCluster> SelectedCluster;
+	int32 ClassCount = 0;
+	bool bScanning = false;
+	bool bScanRejected = false;
+};
+
+class SDuplicateClusterRow : public SMultiColumnTableRow<TSharedPtr<FDuplicateCluster>>
+{
+public:
+	SLATE_BEGIN_ARGS(SDuplicateClusterRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FDuplicateCluster>, Item)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+
+private:
+	TSharedPtr<FDuplicateCluster> Item;
+};
\ No newline at end of file
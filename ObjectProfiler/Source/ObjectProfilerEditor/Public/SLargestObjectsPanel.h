@@ -0,0 +1,64 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Input/SComboBox.h"
+#include "ObjectProfilerTypes.h"
+
+class SLargestObjectsPanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SLargestObjectsPanel) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	TSharedRef<ITableRow> OnGenerateRowForList(TSharedPtr<FLargestObjectEntry> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnEntryDoubleClicked(TSharedPtr<FLargestObjectEntry> Item);
+
+	TSharedRef<SWidget> GenerateSourceComboContent(TSharedPtr<FString> Item);
+	void OnSourceChanged(TSharedPtr<FString> NewSource, ESelectInfo::Type SelectInfo);
+	FText GetSourceText() const;
+
+	FReply OnRefreshClicked();
+	FReply OnFindClicked();
+	FReply OnReferencesClicked();
+	FReply OnInspectClicked();
+	bool HasSelection() const;
+	FText GetSummaryText() const;
+
+	void RebuildSourceOptions();
+	void LoadEntries();
+	void OnHeapWalkComplete(const FHeapWalkResult& WalkResult);
+	TSharedPtr<FLargestObjectEntry> GetSelectedEntry() const;
+
+	TSharedPtr<SListView<TSharedPtr<FLargestObjectEntry>>> EntryListView;
+	TSharedPtr<SComboBox<TSharedPtr<FString>>> SourceCombo;
+
+	TArray<TSharedPtr<FLargestObjectEntry>> EntryItems;
+	TArray<TSharedPtr<FString>> SourceOptions;
+	TSharedPtr<FString> CurrentSource;
+	int64 MaxEntrySize = 1;
+	bool bWalkInFlight = false;
+	FText StatusMessage;
+};
+
+class SLargestObjectRow : public SMultiColumnTableRow<TSharedPtr<FLargestObjectEntry>>
+{
+public:
+	SLATE_BEGIN_ARGS(SLargestObjectRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FLargestObjectEntry>, Item)
+		SLATE_ARGUMENT(int64, MaxEntrySize)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+
+private:
+	TSharedPtr<FLargestObjectEntry> Item;
+	int64 MaxEntrySize = 1;
+};
\ No newline at end of file
@@ -0,0 +1,42 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "ObjectProfilerLayoutAnalyzer.h"
+
+class SLayoutWastePanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SLayoutWastePanel) {}
+		SLATE_ARGUMENT(TArray<TSharedPtr<FObjectClassStats>>, Stats)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	TSharedRef<ITableRow> OnGenerateRowForList(TSharedPtr<FClassLayoutReport> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnSelectionChanged(TSharedPtr<FClassLayoutReport> Item, ESelectInfo::Type SelectInfo);
+	FText GetSummaryText() const;
+	FText GetDetailsText() const;
+
+	TSharedPtr<SListView<TSharedPtr<FClassLayoutReport>>> ReportListView;
+	TArray<TSharedPtr<FClassLayoutReport>> ReportItems;
+	TSharedPtr<FClassLayoutReport> SelectedReport;
+};
+
+class SLayoutWasteRow : public SMultiColumnTableRow<TSharedPtr<FClassLayoutReport>>
+{
+public:
+	SLATE_BEGIN_ARGS(SLayoutWasteRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FClassLayoutReport>, Item)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+
+private:
+	TSharedPtr<FClassLayoutReport> Item;
+};
\ No newline at end of file
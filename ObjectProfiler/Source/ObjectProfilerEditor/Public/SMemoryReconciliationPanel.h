@@ -0,0 +1,32 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+
+class SSparkline;
+
+class SMemoryReconciliationPanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SMemoryReconciliationPanel) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	EActiveTimerReturnType OnRefreshTimer(double InCurrentTime, float InDeltaTime);
+	void Rebuild();
+	void AddRow(TSharedPtr<SVerticalBox> Box, const FText& Label, const FText& ProfilerValue, const FText& ReferenceValue, bool bHeader = false);
+	FText GetSummaryText() const;
+
+	TSharedPtr<SSparkline> UnattributedSparkline;
+	TSharedPtr<SVerticalBox> TotalsBox;
+	TSharedPtr<SVerticalBox> CategoriesBox;
+
+	int32 LastSampleCount = INDEX_NONE;
+	double LastSampleTime = 0.0;
+
+	static constexpr float RefreshIntervalSeconds = 0.5f;
+};
\ No newline at end of file
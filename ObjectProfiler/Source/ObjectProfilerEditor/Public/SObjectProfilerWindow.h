@@ -11,6 +11,7 @@
 #include "ObjectProfilerTypes.h"
 
 class SSparkline;
+class FObjectEventReplay;
 
 class SObjectProfilerWindow : public SCompoundWidget
 {
@@ -35,8 +36,17 @@ private:
 	FReply OnExportClicked();
 	FReply OnFindInContentBrowserClicked();
 	FReply OnShowReferencesClicked();
+	FReply OnShowStartupTimelineClicked();
+	FReply OnShowLargestObjectsClicked();
+	FReply OnShowActorFootprintsClicked();
+	FReply OnShowLayoutWasteClicked();
+	FReply OnShowContainerSlackClicked();
+	FReply OnShowDuplicateContentClicked();
+	FReply OnShowArchiveSizeClicked();
+	FReply OnShowMemoryReconciliationClicked();
 
 	void OnFilterTextChanged(const FText& NewText);
+	void OnScopeTextCommitted(const FText& NewText, ETextCommit::Type CommitType);
 	void OnTreeDoubleClick(TSharedPtr<FProfilerTreeItem> Item);
 	void OnTreeSelectionChanged(TSharedPtr<FProfilerTreeItem> Item, ESelectInfo::Type SelectInfo);
 	
@@ -48,18 +58,26 @@ private:
 	
 	void OnShowOnlyLeakingChanged(ECheckBoxState NewState);
 	void OnShowOnlyHotChanged(ECheckBoxState NewState);
+	void OnCountsFirstChanged(ECheckBoxState NewState);
+	void OnExclusiveSizesChanged(ECheckBoxState NewState);
 
 	void RefreshDataAsync();
 	void OnAsyncCollectionComplete(TArray<TSharedPtr<FObjectClassStats>> Results);
 	void OnAsyncCollectionProgress(float Progress);
+	void OnAsyncCollectionPartial(const TArray<TSharedPtr<FObjectClassStats>>& Results, float Progress);
 	void OnRealTimeUpdate(const TArray<TSharedPtr<FObjectClassStats>>& Results);
 	
 	void OnCompareSnapshots(int32 IndexA, int32 IndexB);
 	void OnViewDelta(int32 SnapshotIndex);
+	void OnReplayLoaded(TSharedRef<FObjectEventReplay> Replay);
 	
 	void ApplyFilter();
 	void RebuildTreeView();
 	void UpdateStatusBar();
+	void RebuildSizeDistributionPanel();
+	void NavigateToObject(FString ObjectPath);
+	TArray<TSharedPtr<FObjectClassStats>> GatherScopeStats() const;
+	TArray<UClass*> GatherScopeClasses() const;
 	
 	EVisibility GetProgressBarVisibility() const;
 	EVisibility GetCancelButtonVisibility() const;
@@ -67,6 +85,7 @@ private:
 	bool IsNotLoading() const;
 	bool CanFindInContentBrowser() const;
 	bool HasSelection() const;
+	bool HasStartupCapture() const;
 
 	TSharedRef<SWidget> GenerateViewModeComboContent(TSharedPtr<FString> Item);
 	TSharedRef<SWidget> GenerateGroupModeComboContent(TSharedPtr<FString> Item);
@@ -89,7 +108,9 @@ private:
 	TSharedPtr<SHeaderRow> HeaderRow;
 	TSharedPtr<STextBlock> StatusText;
 	TSharedPtr<SEditableTextBox> FilterBox;
+	TSharedPtr<SEditableTextBox> ScopeBox;
 	TSharedPtr<SProgressBar> ProgressBar;
+	TSharedPtr<SVerticalBox> SizeDistributionBox;
 	
 	TSharedPtr<SComboBox<TSharedPtr<FString>>> ViewModeCombo;
 	TSharedPtr<SComboBox<TSharedPtr<FString>>> GroupModeCombo;
@@ -102,6 +123,7 @@ private:
 	TArray<TSharedPtr<FObjectClassStats>> FilteredStats;
 	TArray<TSharedPtr<FProfilerTreeItem>> TreeItems;
 	TSharedPtr<FProfilerTreeItem> SelectedTreeItem;
+	TSharedPtr<FObjectEventReplay> ActiveReplay;
 
 	TArray<TSharedPtr<FString>> ViewModeOptions;
 	TArray<TSharedPtr<FString>> GroupModeOptions;
@@ -121,10 +143,12 @@ private:
 	EColumnSortMode::Type CurrentSortMode = EColumnSortMode::Descending;
 	
 	FProfilerFilterSettings FilterSettings;
+	FProfilerCollectionScope CollectionScope;
 	EProfilerViewMode ViewMode = EProfilerViewMode::Normal;
-	EProfilerGroupMode GroupMode = EProfilerGroupMode::None;
+	TArray<EProfilerGroupMode> GroupLevels;
 	
 	float CurrentProgress = 0.0f;
+	bool bShowingProvisional = false;
 	int32 CurrentSnapshotIndex = -1;
 	
 	FDelegateHandle RealTimeUpdateHandle;
@@ -136,6 +160,7 @@ public:
 	SLATE_BEGIN_ARGS(SObjectProfilerTreeRow) {}
 		SLATE_ARGUMENT(TSharedPtr<FProfilerTreeItem>, Item)
 		SLATE_ARGUMENT(EProfilerViewMode, ViewMode)
+		SLATE_ARGUMENT(bool, IsProvisional)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
@@ -144,5 +169,6 @@ public:
 private:
 	TSharedPtr<FProfilerTreeItem> Item;
 	EProfilerViewMode ViewMode = EProfilerViewMode::Normal;
+	bool bIsProvisional = false;
 	TSharedPtr<SSparkline> Sparkline;
 };
\ No newline at end of file
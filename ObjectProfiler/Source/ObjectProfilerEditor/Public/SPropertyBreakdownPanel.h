@@ -0,0 +1,46 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STreeView.h"
+#include "ObjectProfilerPropertyBreakdown.h"
+
+class SPropertyBreakdownPanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SPropertyBreakdownPanel) {}
+		SLATE_ARGUMENT(FString, ObjectPath)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	TSharedRef<ITableRow> OnGenerateRowForTree(TSharedPtr<FPropertyMemoryNode> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnGetChildrenForTree(TSharedPtr<FPropertyMemoryNode> Item, TArray<TSharedPtr<FPropertyMemoryNode>>& OutChildren);
+	void LoadBreakdown(bool bForceRebuild);
+
+	FReply OnRefreshClicked();
+	FText GetSummaryText() const;
+
+	TSharedPtr<STreeView<TSharedPtr<FPropertyMemoryNode>>> BreakdownTreeView;
+	TArray<TSharedPtr<FPropertyMemoryNode>> RootItems;
+	FString ObjectPath;
+};
+
+class SPropertyBreakdownRow : public SMultiColumnTableRow<TSharedPtr<FPropertyMemoryNode>>
+{
+public:
+	SLATE_BEGIN_ARGS(SPropertyBreakdownRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FPropertyMemoryNode>, Item)
+		SLATE_ARGUMENT(int64, RootBytes)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+
+private:
+	TSharedPtr<FPropertyMemoryNode> Item;
+	int64 RootBytes = 0;
+};
\ No newline at end of file
@@ -37,6 +37,7 @@ private:
 	void BuildReferenceTree(UObject* Object, TSharedPtr<FReferenceTreeItem> ParentItem, bool bIncoming, int32 MaxDepth);
 	
 	FReply OnRefreshClicked();
+	FReply OnInspectClicked();
 	void OnInstanceSelected(TSharedPtr<FString> Item, ESelectInfo::Type SelectInfo);
 	
 	TSharedPtr<STreeView<TSharedPtr<FReferenceTreeItem>>> ReferenceTreeView;
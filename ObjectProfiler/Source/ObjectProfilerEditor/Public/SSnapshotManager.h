@@ -7,8 +7,11 @@
 #include "Widgets/Views/SListView.h"
 #include "ObjectProfilerTypes.h"
 
+class FObjectEventReplay;
+
 DECLARE_DELEGATE_TwoParams(FOnCompareSnapshots, int32, int32);
 DECLARE_DELEGATE_OneParam(FOnViewDelta, int32);
+DECLARE_DELEGATE_OneParam(FOnReplayLoaded, TSharedRef<FObjectEventReplay>);
 
 class SSnapshotManager : public SCompoundWidget
 {
@@ -16,6 +19,8 @@ public:
 	SLATE_BEGIN_ARGS(SSnapshotManager) {}
 	SLATE_EVENT(FOnCompareSnapshots, OnCompareSnapshots)
 	SLATE_EVENT(FOnViewDelta, OnViewDelta)
+	SLATE_EVENT(FOnReplayLoaded, OnReplayLoaded)
+	SLATE_ATTRIBUTE(FProfilerCollectionScope, Scope)
 SLATE_END_ARGS()
 
 void Construct(const FArguments& InArgs);
@@ -33,6 +38,9 @@ private:
 	FReply OnLoadClicked();
 	FReply OnCompareClicked();
 	FReply OnViewDeltaClicked();
+	FReply OnRecordClicked();
+	FReply OnReplayClicked();
+	FText GetRecordButtonText() const;
 	
 	void OnSnapshotNameCommitted(const FText& NewText, ETextCommit::Type CommitType);
 	void OnSelectionChanged(TSharedPtr<FObjectSnapshot> Item, ESelectInfo::Type SelectInfo);
@@ -47,6 +55,8 @@ private:
 	
 	FOnCompareSnapshots OnCompareSnapshotsDelegate;
 	FOnViewDelta OnViewDeltaDelegate;
+	FOnReplayLoaded OnReplayLoadedDelegate;
+	TAttribute<FProfilerCollectionScope> Scope;
 	
 	FDelegateHandle SnapshotTakenHandle;
 };
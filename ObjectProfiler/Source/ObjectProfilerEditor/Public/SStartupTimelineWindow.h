@@ -0,0 +1,46 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "ObjectProfilerStartup.h"
+
+class SStartupTimelineWindow : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SStartupTimelineWindow) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	TSharedRef<ITableRow> OnGenerateRowForList(TSharedPtr<FStartupPhaseStats> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnPhaseSelected(TSharedPtr<FStartupPhaseStats> Item, ESelectInfo::Type SelectInfo);
+	void FillTopEntries(TSharedPtr<SVerticalBox> Box, const TMap<FString, int32>& Counts);
+	FText GetSummaryText() const;
+
+	TSharedPtr<SListView<TSharedPtr<FStartupPhaseStats>>> PhaseListView;
+	TSharedPtr<SVerticalBox> TopClassesBox;
+	TSharedPtr<SVerticalBox> TopModulesBox;
+
+	TArray<TSharedPtr<FStartupPhaseStats>> PhaseItems;
+	int32 MaxPhaseCount = 1;
+};
+
+class SStartupPhaseRow : public SMultiColumnTableRow<TSharedPtr<FStartupPhaseStats>>
+{
+public:
+	SLATE_BEGIN_ARGS(SStartupPhaseRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FStartupPhaseStats>, Item)
+		SLATE_ARGUMENT(int32, MaxPhaseCount)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
+
+private:
+	TSharedPtr<FStartupPhaseStats> Item;
+	int32 MaxPhaseCount = 1;
+};
\ No newline at end of file
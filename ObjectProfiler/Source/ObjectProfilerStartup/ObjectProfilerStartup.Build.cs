@@ -0,0 +1,18 @@
+﻿//Copyright PsinaDev 2025.
+
+using UnrealBuildTool;
+
+public class ObjectProfilerStartup : ModuleRules
+{
+	public ObjectProfilerStartup(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Projects"
+		});
+	}
+}
\ No newline at end of file
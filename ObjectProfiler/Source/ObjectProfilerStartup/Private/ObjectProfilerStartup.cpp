@@ -0,0 +1,233 @@
+﻿//Copyright PsinaDev 2025.
+
+#include "ObjectProfilerStartup.h"
+
+#include "Interfaces/IPluginManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Parse.h"
+#include "UObject/Class.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+FCriticalSection FObjectProfilerStartupCapture::PendingLock;
+TMap<const UClass*, int32> FObjectProfilerStartupCapture::PendingClassCounts;
+int32 FObjectProfilerStartupCapture::PendingTotal = 0;
+TArray<FStartupPhaseStats> FObjectProfilerStartupCapture::Phases;
+double FObjectProfilerStartupCapture::PhaseStartSeconds = 0.0;
+bool FObjectProfilerStartupCapture::bCapturing = false;
+FObjectProfilerStartupCapture::FStartupCreateListener* FObjectProfilerStartupCapture::CreateListener = nullptr;
+FDelegateHandle FObjectProfilerStartupCapture::LoadingPhaseHandle;
+FDelegateHandle FObjectProfilerStartupCapture::EngineLoopInitHandle;
+
+void FObjectProfilerStartupCapture::FStartupCreateListener::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
+{
+	if (!Object)
+	{
+		return;
+	}
+
+	const UClass* ObjClass = Object->GetClass();
+	if (!ObjClass)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&PendingLock);
+	PendingClassCounts.FindOrAdd(ObjClass)++;
+	PendingTotal++;
+}
+
+void FObjectProfilerStartupCapture::FStartupCreateListener::OnUObjectArrayShutdown()
+{
+	GUObjectArray.RemoveUObjectCreateListener(this);
+	CreateListener = nullptr;
+	bCapturing = false;
+	delete this;
+}
+
+bool FObjectProfilerStartupCapture::IsRequested()
+{
+	if (FParse::Param(FCommandLine::Get(), TEXT("ObjectProfilerStartup")))
+	{
+		return true;
+	}
+
+	bool bCaptureStartup = false;
+	if (GConfig)
+	{
+		GConfig->GetBool(TEXT("ObjectProfiler"), TEXT("bCaptureStartup"), bCaptureStartup, GEngineIni);
+	}
+
+	return bCaptureStartup;
+}
+
+bool FObjectProfilerStartupCapture::IsCapturing()
+{
+	return bCapturing;
+}
+
+bool FObjectProfilerStartupCapture::HasResults()
+{
+	return Phases.Num() > 0;
+}
+
+const TArray<FStartupPhaseStats>& FObjectProfilerStartupCapture::GetPhases()
+{
+	return Phases;
+}
+
+int32 FObjectProfilerStartupCapture::GetTotalCreated()
+{
+	int32 Total = 0;
+	for (const FStartupPhaseStats& Phase : Phases)
+	{
+		Total += Phase.TotalCreated;
+	}
+	return Total;
+}
+
+void FObjectProfilerStartupCapture::BeginCapture()
+{
+	if (bCapturing)
+	{
+		return;
+	}
+
+	Phases.Empty();
+	PendingClassCounts.Empty();
+	PendingTotal = 0;
+	PhaseStartSeconds = FPlatformTime::Seconds() - GStartTime;
+
+	CreateListener = new FStartupCreateListener();
+	GUObjectArray.AddUObjectCreateListener(CreateListener);
+
+	LoadingPhaseHandle = IPluginManager::Get().OnLoadingPhaseComplete().AddStatic(&FObjectProfilerStartupCapture::OnLoadingPhaseComplete);
+	EngineLoopInitHandle = FCoreDelegates::OnFEngineLoopInitComplete.AddStatic(&FObjectProfilerStartupCapture::OnEngineLoopInitComplete);
+
+	bCapturing = true;
+
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Startup capture started at %.3fs"), PhaseStartSeconds);
+}
+
+void FObjectProfilerStartupCapture::EndCapture()
+{
+	if (!bCapturing)
+	{
+		return;
+	}
+
+	ClosePhase(TEXT("EngineLoopInit"));
+
+	if (CreateListener)
+	{
+		GUObjectArray.RemoveUObjectCreateListener(CreateListener);
+		delete CreateListener;
+		CreateListener = nullptr;
+	}
+
+	IPluginManager::Get().OnLoadingPhaseComplete().Remove(LoadingPhaseHandle);
+	FCoreDelegates::OnFEngineLoopInitComplete.Remove(EngineLoopInitHandle);
+	LoadingPhaseHandle.Reset();
+	EngineLoopInitHandle.Reset();
+
+	bCapturing = false;
+
+	LogSummary();
+}
+
+void FObjectProfilerStartupCapture::OnLoadingPhaseComplete(ELoadingPhase::Type LoadingPhase, bool bSuccess)
+{
+	ClosePhase(ELoadingPhase::ToString(LoadingPhase));
+}
+
+void FObjectProfilerStartupCapture::OnEngineLoopInitComplete()
+{
+	EndCapture();
+}
+
+void FObjectProfilerStartupCapture::ClosePhase(const FString& PhaseName)
+{
+	TMap<const UClass*, int32> ClassCounts;
+	int32 Total = 0;
+	{
+		FScopeLock Lock(&PendingLock);
+		ClassCounts = MoveTemp(PendingClassCounts);
+		PendingClassCounts.Reset();
+		Total = PendingTotal;
+		PendingTotal = 0;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds() - GStartTime;
+
+	FStartupPhaseStats& Phase = Phases.AddDefaulted_GetRef();
+	Phase.PhaseName = PhaseName;
+	Phase.StartSeconds = PhaseStartSeconds;
+	Phase.EndSeconds = NowSeconds;
+	Phase.TotalCreated = Total;
+
+	for (const TPair<const UClass*, int32>& Pair : ClassCounts)
+	{
+		Phase.ClassCounts.FindOrAdd(Pair.Key->GetPathName()) += Pair.Value;
+		Phase.ModuleCounts.FindOrAdd(GetClassModuleName(Pair.Key)) += Pair.Value;
+	}
+
+	Phase.ClassCounts.ValueSort([](int32 A, int32 B) { return A > B; });
+	Phase.ModuleCounts.ValueSort([](int32 A, int32 B) { return A > B; });
+
+	PhaseStartSeconds = NowSeconds;
+}
+
+FString FObjectProfilerStartupCapture::GetClassModuleName(const UClass* InClass)
+{
+	const FString PackageName = InClass->GetOutermost()->GetName();
+
+	if (PackageName.StartsWith(TEXT("/Script/")))
+	{
+		return PackageName.RightChop(8);
+	}
+
+	int32 SeparatorIndex = INDEX_NONE;
+	if (PackageName.Len() > 1 && PackageName.RightChop(1).FindChar(TEXT('/'), SeparatorIndex))
+	{
+		return PackageName.Mid(1, SeparatorIndex);
+	}
+
+	return TEXT("Unknown");
+}
+
+void FObjectProfilerStartupCapture::LogSummary()
+{
+	UE_LOG(LogTemp, Log, TEXT("ObjectProfiler: Startup capture finished, %d objects created across %d phases"), GetTotalCreated(), Phases.Num());
+
+	for (const FStartupPhaseStats& Phase : Phases)
+	{
+		UE_LOG(LogTemp, Log, TEXT("ObjectProfiler:   %s: %d objects in %.3fs"), *Phase.PhaseName, Phase.TotalCreated, Phase.GetDuration());
+
+		int32 Logged = 0;
+		for (const TPair<FString, int32>& Pair : Phase.ModuleCounts)
+		{
+			if (Logged++ >= LogTopEntries)
+			{
+				break;
+			}
+			UE_LOG(LogTemp, Log, TEXT("ObjectProfiler:     %s: %d"), *Pair.Key, Pair.Value);
+		}
+	}
+}
+
+void FObjectProfilerStartupModule::StartupModule()
+{
+	if (FObjectProfilerStartupCapture::IsRequested())
+	{
+		FObjectProfilerStartupCapture::BeginCapture();
+	}
+}
+
+void FObjectProfilerStartupModule::ShutdownModule()
+{
+	FObjectProfilerStartupCapture::EndCapture();
+}
+
+IMPLEMENT_MODULE(FObjectProfilerStartupModule, ObjectProfilerStartup)
\ No newline at end of file
@@ -0,0 +1,69 @@
+﻿//Copyright PsinaDev 2025.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ModuleDescriptor.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectArray.h"
+
+struct FStartupPhaseStats
+{
+	FString PhaseName;
+	double StartSeconds = 0.0;
+	double EndSeconds = 0.0;
+	int32 TotalCreated = 0;
+	TMap<FString, int32> ClassCounts;
+	TMap<FString, int32> ModuleCounts;
+
+	double GetDuration() const { return EndSeconds - StartSeconds; }
+};
+
+class OBJECTPROFILERSTARTUP_API FObjectProfilerStartupCapture
+{
+public:
+	static bool IsRequested();
+	static bool IsCapturing();
+	static bool HasResults();
+
+	static const TArray<FStartupPhaseStats>& GetPhases();
+	static int32 GetTotalCreated();
+
+	static void BeginCapture();
+	static void EndCapture();
+
+private:
+	class FStartupCreateListener : public FUObjectArray::FUObjectCreateListener
+	{
+	public:
+		virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+		virtual void OnUObjectArrayShutdown() override;
+	};
+
+	static void OnLoadingPhaseComplete(ELoadingPhase::Type LoadingPhase, bool bSuccess);
+	static void OnEngineLoopInitComplete();
+	static void ClosePhase(const FString& PhaseName);
+	static FString GetClassModuleName(const UClass* InClass);
+	static void LogSummary();
+
+	static FCriticalSection PendingLock;
+	static TMap<const UClass*, int32> PendingClassCounts;
+	static int32 PendingTotal;
+
+	static TArray<FStartupPhaseStats> Phases;
+	static double PhaseStartSeconds;
+	static bool bCapturing;
+
+	static FStartupCreateListener* CreateListener;
+	static FDelegateHandle LoadingPhaseHandle;
+	static FDelegateHandle EngineLoopInitHandle;
+
+	static constexpr int32 LogTopEntries = 10;
+};
+
+class FObjectProfilerStartupModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
\ No newline at end of file